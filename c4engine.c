@@ -0,0 +1,2754 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "c4engine.h"
+/* Zobrist Hashing
+ *
+ *Every (player, block) pair owns a random 64-bit key, and the 
+ *Hash of a board is the XOR of the keys of all chess on it, 
+ *plus ZobristSide when PLAYER_B is to move. Placing or removing 
+ *a chess is therefore a single XOR, no matter how big the board is.
+ *
+ *The keys come from a fixed seed, so a board always gets the same 
+ *Hash in every run.
+*/
+uint64_t ZobristKey[2][BoardBits];
+uint64_t ZobristSide;
+/* SplitMix64()
+ *
+ *A small pseudo-random generator, only used to fill ZobristKey.
+ *
+ *UPDATE: Also the generator of every random move that has to be 
+ *repeatable or fast (Self-Play, Monte Carlo Tree Search), each 
+ *caller with a seed of its own.
+*/
+uint64_t SplitMix64(uint64_t *seed)
+{
+	uint64_t z = (*seed += 0x9E3779B97F4A7C15ULL);
+	
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+/* FillZobrist()
+ *
+ *Fill the key tables, see InitZobrist().
+*/
+void FillZobrist(void)
+{
+	uint64_t seed = 0x436F6E6E65637434ULL;
+	int i;
+	
+	for(i=0;i<BoardBits;i++)
+	{
+		ZobristKey[0][i] = SplitMix64(&seed);
+		ZobristKey[1][i] = SplitMix64(&seed);
+	}
+	ZobristSide = SplitMix64(&seed);
+}
+/* InitZobrist()
+ *
+ *Fill the key tables, only the first call does the job.
+ *
+ *UPDATE: Safe from any number of threads at once (see RunOnce()), 
+ *so every entry of the library can call it.
+*/
+void InitZobrist()
+{
+	static Once once = OnceInit;
+	
+	RunOnce(&once, FillZobrist);
+}
+/* TTInit()
+ *
+ *(Re)allocate the table within 'bytes' of memory. The number of 
+ *buckets is a power of 2, so a Hash finds its bucket by a mask. 
+ *If the memory cannot be allocated, the search runs without it.
+*/
+void TTInit(TransTable *table, size_t bytes)
+{
+	size_t buckets = 1;
+	
+	while(buckets * 2 * TTBucketSize * sizeof(atomic_uint_least64_t) <= bytes)
+	{
+		buckets *= 2;
+	}
+	
+	free(table->Entries);
+	table->Entries = (atomic_uint_least64_t*)calloc(buckets * TTBucketSize, sizeof(atomic_uint_least64_t));
+	table->Buckets = (table->Entries == NULL)?(0):(buckets);
+}
+/* TTClear()
+ *
+ *Forget everything, for a new game. No search may be using 
+ *the table at that time.
+*/
+void TTClear(TransTable *table)
+{
+	if(table->Entries != NULL)
+	{
+		memset(table->Entries, 0, table->Buckets * TTBucketSize * sizeof(atomic_uint_least64_t));
+	}
+	
+	table->Generation = 0;
+}
+/* TTNewSearch()
+ *
+ *Start a new Generation, see "Aging". No search may be using 
+ *the table at that time.
+*/
+void TTNewSearch(TransTable *table)
+{
+	table->Generation = (table->Generation + 1) & TTAgeMask;
+}
+/* TTProbe()
+ *
+ *Look up the scene with Hash 'key'. Returns false if it has not 
+ *been evaluated yet, otherwise *entry is filled.
+*/
+bool TTProbe(TransTable *table, uint64_t key, TTEntry *entry)
+{
+	atomic_uint_least64_t *bucket;
+	uint64_t word;
+	int i;
+	
+	if(table->Buckets == 0)
+	{
+		return false;
+	}
+	
+	bucket = &table->Entries[(key & (table->Buckets - 1)) * TTBucketSize];
+	
+	for(i=0;i<TTBucketSize;i++)
+	{
+		word = atomic_load_explicit(&bucket[i], memory_order_relaxed);
+		
+		if(word != 0 && (uint32_t)(word >> 32) == (uint32_t)(key >> 32))
+		{
+			entry->Key = (uint32_t)(word >> 32);
+			entry->Score = (int16_t)(word >> 16);
+			entry->Depth = (int)((word >> 8) & 0xFF);
+			entry->Flag = (int)((word >> 4) & 0x3);
+			entry->Age = (int)((word >> 6) & TTAgeMask);
+			entry->BestMove = ((word & 0xF) == 0xF)?(-1):((int)(word & 0xF));
+			return true;
+		}
+	}
+	
+	return false;
+}
+/* TTStore()
+ *
+ *Remember the result of a scene, see "Replacement Policy".
+*/
+void TTStore(TransTable *table, uint64_t key, int score, int depth, int flag, int move)
+{
+	atomic_uint_least64_t *entry;
+	uint64_t word;
+	
+	if(table->Buckets == 0)
+	{
+		return;
+	}
+	
+	entry = &table->Entries[(key & (table->Buckets - 1)) * TTBucketSize];
+	word = atomic_load_explicit(entry, memory_order_relaxed);
+	
+	// Keep the deeper result in the first entry, see "Aging"
+	if((uint32_t)(word >> 32) != (uint32_t)(key >> 32) 
+	   && (int)((word >> 8) & 0xFF) - ((table->Generation - (int)((word >> 6) & TTAgeMask)) & TTAgeMask) > depth)
+	{
+		entry++;
+	}
+	
+	word = ((key >> 32) << 32)
+	     | ((uint64_t)(uint16_t)score << 16)
+	     | ((uint64_t)(depth & 0xFF) << 8)
+	     | ((uint64_t)table->Generation << 6)
+	     | ((uint64_t)(flag & 0x3) << 4)
+	     | (uint64_t)(move & 0xF);
+	
+	atomic_store_explicit(entry, word, memory_order_relaxed);
+}
+/* CalculateCoordinateY()
+ *
+ *This function is a helper function of DetermineBestMove().
+ *
+ *DetermineBestMove() only returns the x-coordinate of next 
+ *move. So CalculateCoordinateY() can read the Height of that 
+ *column to find the y-coordinate. Because in each turn, the 
+ *x-coordinate of next move is unique.
+ *
+ *Returns -1 if x is out of range or the column is full.
+ *
+ *UPDATE: The state is no longer copied, only read.
+*/
+int CalculateCoordinateY(const RoundState *state, int x)
+{
+	if(x < 0 || x > MaxX || state->Height[x] == ColumnHeight)
+	{
+		return -1;
+	}
+	
+	return MaxY - state->Height[x];
+}
+/* SceneAt()
+ *
+ *Conversion layer between the bitboards and Scene: returns the 
+ *code of block (x,y) as described in "Thorough Explanation of Scene".
+*/
+int SceneAt(const RoundState *state, int x, int y)
+{
+	Bitboard bit = CellBit(x, y);
+	
+	if(state->Board[PLAYER_A-1] & bit)
+	{
+		return PLAYER_A;
+	}
+	if(state->Board[PLAYER_B-1] & bit)
+	{
+		return PLAYER_B;
+	}
+	
+	// The only empty block that accepts a move is the lowest one
+	return (MaxY - y == state->Height[x])?(0):(-1);
+}
+/* Static Evaluation
+ *
+ *Grade a board without a result by the win lines, i.e. every 
+ *ConnectLength blocks in a row where a strand can still be made:
+ * - A line holding chess of both players is dead, worth nothing.
+ * - Otherwise it is worth EvalWeight(n) to the owner of its n chess, 
+ *   4 times more for each chess, so open 2s and 3s count.
+ * - A chess in the center is part of the most lines, and it also 
+ *   earns EvalCenter for each column it is away from the edge.
+ * - A line missing 1 chess is a threat. When the board fills up, the player who moved 
+ *   first gets the odd rows (1st, 3rd, 5th from the bottom) and the 
+ *   other one the even rows, so a threat on a row of its own parity 
+ *   is far more dangerous and earns EvalParity more.
+ *
+ *WinLine holds the mask of every line, and CellLines the lines 
+ *through each block. MakeMove() and RetractMove() only grade the 
+ *lines through the chess they touch before and after, and add the 
+ *difference to the Eval of the board, so a leaf costs nothing.
+ *
+ *Set StaticEvaluation to 0 (-DStaticEvaluation=0) to grade every 
+ *such scene 0 again.
+*/
+#ifndef StaticEvaluation
+#define StaticEvaluation 1
+#endif
+#define LineSpan(max) ((max) + 2 - ConnectLength) // Where a line can start along an axis
+#define WinLineCount  (LineSpan(MaxX)*(MaxY+1) + (MaxX+1)*LineSpan(MaxY) + 2*LineSpan(MaxX)*LineSpan(MaxY))
+#define MaxCellLines  (4*ConnectLength)
+#define EvalWeight(n) (1 << 2*((n)-1))
+#define EvalParity    24
+#define EvalCenter    2
+#define EvalLimit     (WinPosition / 2)
+
+Bitboard WinLine[WinLineCount];
+unsigned char CellLines[BoardBits][MaxCellLines];
+unsigned char CellLineCount[BoardBits];
+/* FillEvaluation()
+ *
+ *Fill WinLine and CellLines, see InitEvaluation().
+*/
+void FillEvaluation(void)
+{
+	int x, y, m, k, n = 0, bit;
+	int dx[4] = {0, 1, 1, 1}, dy[4] = {1, 0, 1, -1}; // As Direction
+	Bitboard line;
+	
+	// Counted from the bottom, as the bits
+	for(x=0;x<=MaxX;x++)
+	{
+		for(y=0;y<=MaxY;y++)
+		{
+			for(m=0;m<4;m++)
+			{
+				k = ConnectLength - 1;
+				if(x + k*dx[m] > MaxX || y + k*dy[m] > MaxY || y + k*dy[m] < 0)
+				{
+					continue;
+				}
+				
+				line = 0;
+				for(k=0;k<ConnectLength;k++)
+				{
+					bit = (x + k*dx[m])*ColumnBits + y + k*dy[m];
+					line |= (Bitboard)1 << bit;
+					CellLines[bit][CellLineCount[bit]++] = n;
+				}
+				WinLine[n++] = line;
+			}
+		}
+	}
+}
+/* InitEvaluation()
+ *
+ *Fill WinLine and CellLines, only the first call does the job.
+ *
+ *UPDATE: Safe from any number of threads at once, as InitZobrist().
+*/
+void InitEvaluation()
+{
+	static Once once = OnceInit;
+	
+	RunOnce(&once, FillEvaluation);
+}
+/* CountChess()
+ *
+ *Number of chess on a bitboard.
+*/
+int CountChess(Bitboard b)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(b);
+#else
+	int n = 0;
+	
+	for(; b != 0; b &= b - 1)
+	{
+		n++;
+	}
+	return n;
+#endif
+}
+/* LineValue()
+ *
+ *Worth of a win line for PLAYER_A (negative for PLAYER_B). 'first' 
+ *is the player who moved first in this game.
+*/
+int LineValue(const RoundState *state, Bitboard line, PLAYER first)
+{
+	int a = CountChess(state->Board[PLAYER_A-1] & line);
+	int b = CountChess(state->Board[PLAYER_B-1] & line);
+	int n = a + b, value, row;
+	PLAYER owner = (a > 0)?(PLAYER_A):(PLAYER_B);
+	
+	if((a > 0 && b > 0) || n == 0 || n == ConnectLength)
+	{
+		return 0;
+	}
+	
+	value = EvalWeight(n);
+	
+	if(n == ConnectLength - 1)
+	{
+		// Row of the empty block, 0 is the bottom (1st) row
+		row = CountChess((line & ~(state->Board[0] | state->Board[1])) - 1) % ColumnBits;
+		if((row % 2 == 0) == (owner == first))
+		{
+			value += EvalParity;
+		}
+	}
+	
+	return (owner == PLAYER_A)?(value):(-value);
+}
+/* CellValue()
+ *
+ *Sum of LineValue() of the lines through 'bit', plus the center 
+ *control of the chess on it.
+*/
+int CellValue(const RoundState *state, int bit)
+{
+	int i, x = bit / ColumnBits, value = 0;
+	Bitboard block = (Bitboard)1 << bit;
+	PLAYER first;
+	
+	// Twice the distance from the nearest edge, even boards have 2 centers
+	if(state->Board[PLAYER_A-1] & block)
+	{
+		value = EvalCenter * (MaxX - abs(2*x - MaxX));
+	}
+	else if(state->Board[PLAYER_B-1] & block)
+	{
+		value = -EvalCenter * (MaxX - abs(2*x - MaxX));
+	}
+	
+	first = ((state->Moves % 2 == 0) == (state->CurrentPlayer == PLAYER_A))?(PLAYER_A):(PLAYER_B);
+	
+	for(i=0;i<CellLineCount[bit];i++)
+	{
+		value += LineValue(state, WinLine[CellLines[bit][i]], first);
+	}
+	
+	return value;
+}
+/* StaticScore()
+ *
+ *The Eval of a scene for the player to move, within EvalLimit.
+*/
+int StaticScore(const RoundState *state)
+{
+	int score = (state->CurrentPlayer == PLAYER_A)?(state->Eval):(-state->Eval);
+	
+	if(score >= EvalLimit)
+	{
+		return EvalLimit - 1;
+	}
+	if(score <= -EvalLimit)
+	{
+		return 1 - EvalLimit;
+	}
+	
+	return score;
+}
+/* GameInit()
+ *
+ *Preparations before the game starts.
+ *
+ *UPDATE: The seed of rand() is no longer set here: whatever is random 
+ *now draws from a seed of its own, see SplitMix64().
+*/
+void GameInit(RoundState *state, PLAYER player)
+{
+	int i;
+	
+	// Empty the board
+	state->Board[0] = 0;
+	state->Board[1] = 0;
+	
+	// Every column is open from the bottom
+	for(i=0;i<=MaxX;i++)
+	{
+		state->Height[i] = 0;
+	}
+	
+	state->CurrentPlayer = player;
+	
+	// Reset the global counter
+	state->Moves = 0;
+	
+	// Hash of the empty board
+	InitZobrist();
+	state->Hash = (player == PLAYER_B)?(ZobristSide):(0);
+	
+	// Nothing to grade yet
+	InitEvaluation();
+	state->Eval = 0;
+}
+/* Opponent()
+ *
+ *UPDATE: Find the opponent of the player who is currently playing.
+*/
+PLAYER Opponent(PLAYER CurrentPlayer)
+{
+	switch(CurrentPlayer)
+	{
+		case PLAYER_A:
+			return PLAYER_B;
+			
+		case PLAYER_B:
+		default:
+			return PLAYER_A;
+	}
+}
+/* MakeMove()
+ *Old SetNewChess()
+ *
+ *UPDATE: In order to consider the effeciency, MakeMove() 
+ *will no longer check if the coordinate is in the correct range.
+ *
+ *UPDATE: The chess always lands on top of column x, so y is only 
+ *kept for the callers that already know it.
+ *
+ *UPDATE: Returns the player who wins with this move, or -1. A new 
+ *winner strand must pass the chess just placed, so it is much 
+ *cheaper than calling FindWinner() afterwards.
+ *
+ *UPDATE: Eval is updated by the lines through the new chess.
+ *
+ *UPDATE: A column out of the board (e.g. the -1 of a full board 
+ *from RandomMove()) is ignored, and -1 is returned.
+*/
+int MakeMove(RoundState *state, int x, int y)
+{
+	int code = -1;
+	int bit;
+	Bitboard move;
+	Bitboard *board = &state->Board[state->CurrentPlayer-1];
+	
+	(void)y;
+	
+	if(x < 0 || x > MaxX)
+	{
+		return -1;
+	}
+	
+	bit = x*ColumnBits + state->Height[x];
+	move = (Bitboard)1 << bit;
+	
+	// Mark that position
+	state->Eval -= CellValue(state, bit);
+	*board |= move;
+	state->Eval += CellValue(state, bit);
+	state->Hash ^= ZobristKey[state->CurrentPlayer-1][bit] ^ ZobristSide;
+	
+	// Nobody can win before FirstWinMove
+	if(state->Moves + 1 >= FirstWinMove && ConnectedThrough(*board, move))
+	{
+		code = state->CurrentPlayer;
+	}
+	
+	// Update the Height of this column
+	state->Height[x]++;
+	
+	// Reverse the player
+	state->CurrentPlayer = Opponent(state->CurrentPlayer);
+	
+	// Finish this turn
+	state->Moves++;
+	
+	return code;
+}
+/* RetractMove()
+ *
+ *UPDATE: Retract one move, actually does the same job as MakeMove().
+ *
+ *UPDATE: In order to consider the effeciency, RetractMove() 
+ *will also not check if the coordinate is in the correct range. 
+ *So if it will be used by users, adding a function CheckRetraction() 
+ *is necessary to make sure if this position is the top number(1 or 2) 
+ *of this column.
+ *
+ *UPDATE: Only the top chess of column x can be retracted, so y is 
+ *ignored as in MakeMove().
+*/
+void RetractMove(RoundState *state, int x, int y)
+{
+	int bit;
+	
+	(void)y;
+	
+	// Reverse the player
+	state->CurrentPlayer = Opponent(state->CurrentPlayer);
+	
+	// Roll back this turn
+	state->Moves--;
+	
+	// Reset this position
+	state->Height[x]--;
+	bit = x*ColumnBits + state->Height[x];
+	state->Eval -= CellValue(state, bit);
+	state->Board[state->CurrentPlayer-1] &= ~((Bitboard)1 << bit);
+	state->Eval += CellValue(state, bit);
+	state->Hash ^= ZobristKey[state->CurrentPlayer-1][bit] ^ ZobristSide;
+}
+/* FindWinner()
+ *
+ *UPDATE: new update of CheckWinner(), it is faster.
+ *
+ *UPDATE: Works on the bitboards, every strand of the board is 
+ *checked at once by Alignment().
+ *
+ *UPDATE: The state is no longer copied, only read.
+*/
+int FindWinner(const RoundState *state)
+{
+	if(state->Moves < FirstWinMove)
+	{
+		return -1;
+	}
+	
+	if(Alignment(state->Board[PLAYER_A-1]))
+	{
+		return PLAYER_A;
+	}
+	if(Alignment(state->Board[PLAYER_B-1]))
+	{
+		return PLAYER_B;
+	}
+	
+	return -1;
+}
+/* PlayMoves()
+ *
+ *Make the moves written in 'moves', one digit (the column) per 
+ *move, e.g. "3342". Returns false if a move is illegal or the game 
+ *is already over before the last move.
+*/
+bool PlayMoves(RoundState *state, const char *moves)
+{
+	int x;
+	
+	for(; *moves != '\0'; moves++)
+	{
+		x = *moves - '0';
+		
+		if(CalculateCoordinateY(state, x) == -1)
+		{
+			return false;
+		}
+		if(MakeMove(state, x, 0) != -1 && moves[1] != '\0')
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+/* GetTimeMs()
+ *
+ *Wall-clock time in milliseconds, only differences of it 
+ *are meaningful.
+*/
+long long GetTimeMs()
+{
+#ifdef _WIN32
+	return (long long)GetTickCount64();
+#else
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#endif
+}
+/* ThreadStart(), ThreadJoin() and ThreadDetach()
+ *
+ *Start 'routine' in a new thread / wait for it to finish / let it 
+ *finish on its own. ThreadStart() returns false if the thread 
+ *cannot be created.
+*/
+#ifdef _WIN32
+bool ThreadStart(ThreadHandle *thread, LPTHREAD_START_ROUTINE routine, void *param)
+{
+	*thread = CreateThread(NULL, 0, routine, param, 0, NULL);
+	return *thread != NULL;
+}
+void ThreadJoin(ThreadHandle thread)
+{
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+}
+void ThreadDetach(ThreadHandle thread)
+{
+	CloseHandle(thread);
+}
+#else
+bool ThreadStart(ThreadHandle *thread, void* (*routine)(void*), void *param)
+{
+	return pthread_create(thread, NULL, routine, param) == 0;
+}
+void ThreadJoin(ThreadHandle thread)
+{
+	pthread_join(thread, NULL);
+}
+void ThreadDetach(ThreadHandle thread)
+{
+	pthread_detach(thread);
+}
+#endif
+/* Locks and Conditions
+ *
+ *Thin wrappers over the mutex and condition variable of the 
+ *platform. ConditionWait() releases 'lock' while it waits and 
+ *takes it again before it returns; callers recheck what they wait 
+ *for, since a wait can end without a wake.
+*/
+#ifdef _WIN32
+void LockInit(Lock *lock){	InitializeCriticalSection(lock);}
+void LockAcquire(Lock *lock){	EnterCriticalSection(lock);}
+void LockRelease(Lock *lock){	LeaveCriticalSection(lock);}
+void LockFree(Lock *lock){	DeleteCriticalSection(lock);}
+void ConditionInit(Condition *condition){	InitializeConditionVariable(condition);}
+void ConditionWait(Condition *condition, Lock *lock){	SleepConditionVariableCS(condition, lock, INFINITE);}
+void ConditionWake(Condition *condition){	WakeConditionVariable(condition);}
+void ConditionWakeAll(Condition *condition){	WakeAllConditionVariable(condition);}
+void ConditionFree(Condition *condition){	(void)condition;}
+#else
+void LockInit(Lock *lock){	pthread_mutex_init(lock, NULL);}
+void LockAcquire(Lock *lock){	pthread_mutex_lock(lock);}
+void LockRelease(Lock *lock){	pthread_mutex_unlock(lock);}
+void LockFree(Lock *lock){	pthread_mutex_destroy(lock);}
+void ConditionInit(Condition *condition){	pthread_cond_init(condition, NULL);}
+void ConditionWait(Condition *condition, Lock *lock){	pthread_cond_wait(condition, lock);}
+void ConditionWake(Condition *condition){	pthread_cond_signal(condition);}
+void ConditionWakeAll(Condition *condition){	pthread_cond_broadcast(condition);}
+void ConditionFree(Condition *condition){	pthread_cond_destroy(condition);}
+#endif
+/* RunOnce()
+ *
+ *Run 'routine' if no call with 'once' has run it yet. The other
+ *threads that get there meanwhile wait until it is done.
+*/
+#ifdef _WIN32
+BOOL CALLBACK RunOnceRoutine(PINIT_ONCE once, PVOID routine, PVOID *context)
+{
+	(void)once;
+	(void)context;
+
+	((void (*)(void))routine)();
+	return TRUE;
+}
+void RunOnce(Once *once, void (*routine)(void))
+{
+	InitOnceExecuteOnce(once, RunOnceRoutine, (PVOID)routine, NULL);
+}
+#else
+void RunOnce(Once *once, void (*routine)(void))
+{
+	pthread_once(once, routine);
+}
+#endif
+/* SleepMs()
+ *
+ *Let the calling thread wait 'ms' milliseconds.
+*/
+void SleepMs(int ms)
+{
+#ifdef _WIN32
+	Sleep((DWORD)ms);
+#else
+	struct timespec wait;
+	
+	wait.tv_sec = ms / 1000;
+	wait.tv_nsec = (long)(ms % 1000) * 1000000L;
+	nanosleep(&wait, NULL);
+#endif
+}
+/* CountCores()
+ *
+ *Number of processors the machine has, at least 1.
+*/
+int CountCores()
+{
+	long cores;
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	
+	GetSystemInfo(&info);
+	cores = (long)info.dwNumberOfProcessors;
+#else
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	
+	return (cores < 1)?(1):((int)cores);
+}
+/* SearchContextInit()
+ *
+ *Prepare a context that searches with 'table'.
+*/
+void SearchContextInit(SearchContext *ctx, TransTable *table)
+{
+	memset(ctx, 0, sizeof(SearchContext));
+	memset(ctx->Killer, -1, sizeof(ctx->Killer));
+	ctx->Table = table;
+}
+/* TimeOut()
+ *
+ *Count a scene and check the deadline.
+*/
+bool TimeOut(SearchContext *ctx)
+{
+	if((++ctx->Nodes & (TimeCheckNodes - 1)) == 0)
+	{
+		if((ctx->Deadline != 0 && GetTimeMs() >= ctx->Deadline) 
+		   || (ctx->Signal != NULL && atomic_load(ctx->Signal)))
+		{
+			ctx->Stop = true;
+		}
+	}
+	
+	return ctx->Stop;
+}
+/* Move Ordering
+ *
+ *Alpha-Beta prunes the most when the best move is tried first, so 
+ *the moves of a scene are sorted before they are simulated:
+ *
+ * 1. The best move known by the Transposition Table, which is also 
+ *    the best move of the previous iteration at the top. If the 
+ *    table has lost the scene, the move of the Principal Variation 
+ *    of the previous search, if the scene is on it.
+ * 2. The Killer Moves: the last 2 moves that caused a cutoff after 
+ *    the same number of moves, in any scene.
+ * 3. The others by their History score: how much each (player, 
+ *    block) has caused cutoffs during this search, weighted by the 
+ *    depth of the cutoff.
+ *
+ *Ties keep the CenterOrder, central columns first, because they 
+ *belong to more strands. Before anything is learned, this is the 
+ *whole order.
+ *
+ *Stats counts the cutoffs, and those caused by the first move 
+ *tried. Their ratio shows how good the order is.
+ *
+ *All of them are kept in the SearchContext. Between two searches 
+ *of the same game, the Killer Moves are kept (they belong to a 
+ *number of moves, not to a search) and History is halved by 
+ *AgeMoveOrder(), so what the previous move has learned still 
+ *counts, but less than what is learned now.
+*/
+#define TTMovePriority     (1 << 30)
+#define KillerPriority     (1 << 29)
+#define HistoryLimit       (1 << 20)
+
+/* ClearMoveOrder()
+ *
+ *Forget the Killer Moves and History, for a new game.
+*/
+void ClearMoveOrder(SearchContext *ctx)
+{
+	memset(ctx->Killer, -1, sizeof(ctx->Killer));
+	memset(ctx->History, 0, sizeof(ctx->History));
+	memset(&ctx->Stats, 0, sizeof(ctx->Stats));
+}
+/* AgeMoveOrder()
+ *
+ *Prepare the Move Ordering for the next search of the same game.
+*/
+void AgeMoveOrder(SearchContext *ctx)
+{
+	int i;
+	
+	for(i=0;i<BoardBits;i++)
+	{
+		ctx->History[0][i] /= 2;
+		ctx->History[1][i] /= 2;
+	}
+	memset(&ctx->Stats, 0, sizeof(ctx->Stats));
+}
+/* OrderMoves()
+ *
+ *Fill Order with the columns that are open, best candidates first. 
+ *TTMove is the best move from the Transposition Table, or -1. 
+ *Returns the number of moves.
+*/
+int OrderMoves(SearchContext *ctx, const RoundState *state, int TTMove, int Order[MaxX+1])
+{
+	int Priority[MaxX+1];
+	int i, j, x, p, count = 0;
+	int *killer = ctx->Killer[state->Moves];
+	
+	if(TTMove == -1 && ctx->PV != NULL && ctx->PV->Key[state->Moves] == state->Hash)
+	{
+		TTMove = ctx->PV->Move[state->Moves];
+	}
+	
+	for(i=0;i<=MaxX;i++)
+	{
+		x = CenterOrder((i + ctx->Perturb) % (MaxX+1));
+		
+		if(state->Height[x] == ColumnHeight)
+		{
+			continue;
+		}
+		
+		if(x == TTMove)
+		{
+			p = TTMovePriority;
+		}
+		else if(x == killer[0] || x == killer[1])
+		{
+			p = KillerPriority - (x == killer[1]);
+		}
+		else
+		{
+			p = ctx->History[state->CurrentPlayer-1][x*ColumnBits + state->Height[x]];
+		}
+		
+		// Insertion sort, equal priorities keep the CenterOrder
+		for(j=count; j>0 && Priority[j-1] < p; j--)
+		{
+			Order[j] = Order[j-1];
+			Priority[j] = Priority[j-1];
+		}
+		Order[j] = x;
+		Priority[j] = p;
+		count++;
+	}
+	
+	return count;
+}
+/* LearnCutoff()
+ *
+ *Column x caused a cutoff 'depth' moves above the bottom of the 
+ *search, remember it as a Killer Move and in History.
+*/
+void LearnCutoff(SearchContext *ctx, const RoundState *state, int x, int depth)
+{
+	int *killer = ctx->Killer[state->Moves];
+	int *history = ctx->History[state->CurrentPlayer-1];
+	int i;
+	
+	if(killer[0] != x)
+	{
+		killer[1] = killer[0];
+		killer[0] = x;
+	}
+	
+	history[x*ColumnBits + state->Height[x]] += depth * depth;
+	
+	// Keep History below the priority of Killer Moves
+	if(history[x*ColumnBits + state->Height[x]] > HistoryLimit)
+	{
+		for(i=0;i<BoardBits;i++)
+		{
+			history[i] /= 2;
+		}
+	}
+}
+/* Minimax Algorithm
+ *
+ *DetermineBestMove() and EvaluatePosition()
+ *
+ *The core is a recursion involved two functions. These 2 functions 
+ *call each other to evaluate 'current' Scene.
+ *
+ *DetermineBestMove() will simulate what the Scene would look like 
+ *next step as many as possible. How many scenario it can evaluate 
+ *depends on the 'depth' value. Bsed on the experimental data, when 
+ *depth = 10, it is goning to take more than a minute to think.
+ *
+ *Since it is a game, the winning and losing scenes might occur at 
+ *any round, instead after all blocks are filled. So the number of 
+ *all possiblities would be extremely hard to determine accurately.
+ *
+ *UPDATE: 'depth' now counts the moves that are still to be simulated, 
+ *so one recursion can be asked for any depth (see DetermineBestMoveTimed()).
+ *
+ *UPDATE: The recursion is now Negamax with Alpha-Beta pruning. 
+ *[alpha, beta] is the window of scores that still matters to the 
+ *players above: alpha is what the player to move is already sure 
+ *to get, beta is what the opponent will allow at most. As soon as 
+ *a move reaches beta, the opponent would never let this scene 
+ *happen, so the remaining moves are skipped. With the full window 
+ *at the top, the best move is the same as the one of plain Minimax.
+ *
+ *UPDATE: The whole search works on one RoundState: each move is 
+ *made on it and retracted afterwards, instead of handing a copy 
+ *to every level. The moves of each level are kept in the MoveStack 
+ *of the SearchContext, so a level of the recursion only needs a 
+ *few integers of the stack.
+*/
+int EvaluatePosition(SearchContext*, RoundState*, int, int, int, int);
+/* EvaluateBestMove()
+ *
+ *Entry point of the evaluation.
+ *
+ *Find a best move among those simulated scenes. how many final-round 
+ *situations can be simulated depends on depth value.
+ *
+ *The concept is easy: EvaluateBestMove(), assisted with EvaluatePosition(), 
+ *continuously plays(simulates) this game. When a result occurs(win/lose/draw), 
+ *EvaluateBestMove() will catch a rating of this simulation, if the rating is 
+ *benefit for the player to move, and better than previous one, this 
+ *simulation(move) will be reserved.
+ *
+ *UPDATE: *MoveRating is the Negamax score of this scene for the player 
+ *to move. If it is not inside (alpha, beta), it is only a bound.
+ *
+ *UPDATE: A scene that has been evaluated at least as deep before is 
+ *answered by the Transposition Table, and every result is stored there.
+ *
+ *UPDATE: Moves are simulated in the order of OrderMoves(), see 
+ *"Move Ordering".
+ *
+ *UPDATE: 'state' is changed during the search, and restored when 
+ *it returns.
+ *
+ *UPDATE: An entry whose move is not legal here is taken as a miss.
+*/
+int EvaluateBestMove(SearchContext *ctx, RoundState *state, int *MoveRating, int depth, int alpha, int beta)
+{
+	int i, n, count;
+	int *Order = ctx->MoveStack[state->Moves];
+	int BestMoveX = -1;
+	int MaxRating = -InfiniteScore; // in order to be replaced at the first time
+	int Rating;
+	int code;
+	int AlphaOrigin;
+	TTEntry entry;
+	bool found = TTProbe(ctx->Table, state->Hash, &entry);
+	
+	// Only part of the Hash is kept, so another scene may have left 
+	//its move here: a move this scene cannot make is a miss
+	if(found && entry.BestMove != -1 
+	   && (entry.BestMove > MaxX || state->Height[entry.BestMove] >= ColumnHeight))
+	{
+		found = false;
+	}
+	
+	StatAdd(ctx, Interior, 1);
+	StatAdd(ctx, TTHits, found);
+	StatAdd(ctx, TTMisses, !found);
+	
+	if(found && entry.Depth >= depth && entry.BestMove != -1)
+	{
+		Rating = entry.Score;
+		
+		if(entry.Flag == BoundExact)
+		{
+			*MoveRating = Rating;
+			return entry.BestMove;
+		}
+		if(entry.Flag == BoundLower && Rating > alpha)
+		{
+			alpha = Rating;
+		}
+		if(entry.Flag == BoundUpper && Rating < beta)
+		{
+			beta = Rating;
+		}
+		if(alpha >= beta)
+		{
+			*MoveRating = Rating;
+			return entry.BestMove;
+		}
+	}
+	
+	// The bound of the result is told by the window the moves are 
+	//searched with, which the table may have narrowed
+	AlphaOrigin = alpha;
+	
+	count = OrderMoves(ctx, state, (found)?(entry.BestMove):(-1), Order);
+	
+	for(n=0; n<count; n++)
+	{
+		i = Order[n];
+		
+		// Tactical Prediction Stage
+		
+		// Virtually make a move
+		code = MakeMove(state, i, 0);
+		StatAdd(ctx, WinChecks, state->Moves >= FirstWinMove);
+		
+		// Evaluate this move
+		//This is tricky: Each simulated step is actually made by different 
+		//players, so a good scene for the opponent is a bad one for us. 
+		//Therefore the rating of the opponent is reversed, and so is 
+		//the window.
+		Rating = -EvaluatePosition(ctx, state, code, depth - 1, -beta, -alpha);
+		
+		// Retract this move, that is why we call it 'virtual'
+		RetractMove(state, i, 0);
+		
+		// Out of time, this result is meaningless
+		if(ctx->Stop)
+		{
+			return BestMoveX;
+		}
+		
+		// Primary Rating Mechanism
+		if (Rating > MaxRating)
+		{
+			BestMoveX = i;
+			MaxRating = Rating;
+		}
+		
+		if(Rating > alpha)
+		{
+			alpha = Rating;
+		}
+		
+		// The opponent will never allow this scene, stop here
+		if(alpha >= beta)
+		{
+			StatAdd(ctx, Cutoffs, 1);
+			StatAdd(ctx, FirstCutoffs, n == 0);
+			
+			LearnCutoff(ctx, state, i, depth);
+			break;
+		}
+	}
+	
+	// Rating of the CURRENT Move
+	*MoveRating = MaxRating;
+	
+	TTStore(ctx->Table, state->Hash, MaxRating, depth,
+	        (MaxRating <= AlphaOrigin)?(BoundUpper):((MaxRating >= beta)?(BoundLower):(BoundExact)),
+	        BestMoveX);
+	
+	//For this game only, we do not need to return a coordinate. 
+	//Because at each turn, the x-coordinate is unique in Height, 
+	//y-coordinate, however, is not.
+	return BestMoveX;
+}
+/* EvaluatePosition()
+ *
+ *This function is easier to understand: check if the simulation is 
+ *over(hence the game is over). If so, grade this simulation; if not, 
+ *come back to DetermineBestMove() to proceed the current simulation.
+ *
+ *UPDATE: code is the winner reported by the MakeMove() that led 
+ *here, so the board no longer needs to be scanned by FindWinner().
+ *
+ *UPDATE: The grade is seen from the player to move. If there is a 
+ *winner, it is the previous player, so this is a lost scene.
+ *
+ *UPDATE: A scene at the end of 'depth' is graded by StaticScore().
+ *
+ *UPDATE: Like EvaluateBestMove(), it works on 'state' in place.
+*/
+int EvaluatePosition(SearchContext *ctx, RoundState *state, int code, int depth, int alpha, int beta)
+{
+	int rate = 0; // Left alone when EvaluateBestMove() runs out of time
+	
+	if(TimeOut(ctx))
+	{
+		return 0;
+	}
+	
+	StatAdd(ctx, Leaves, code != -1 || depth <= 0 || state->Moves == BoardCells);
+	
+	if(code != -1)
+	{
+		return -(WinPosition - state->Moves);
+	}
+	
+	if(state->Moves == BoardCells)
+	{
+		return 0;
+	}
+	
+	if(depth <= 0)
+	{
+#if StaticEvaluation
+		return StaticScore(state);
+#else
+		return 0;
+#endif
+	}
+	
+	// Game is undergoing, proceed the simulation
+	EvaluateBestMove(ctx, state, &rate, depth, alpha, beta);
+	return rate;
+}
+/* RatingOf()
+ *
+ *Translate a Negamax score of the player to move into the 
+ *Rating System.
+*/
+int RatingOf(int score)
+{
+	if(IsWinScore(score))
+	{
+		return WinPosition;
+	}
+	if(IsWinScore(-score))
+	{
+		return LosePosition;
+	}
+	
+	return NeutralPosition;
+}
+/* TallyVictories()
+ *
+ *Secondary Rating Mechanism: play every simulation 'depth' moves 
+ *further without pruning, and count the scenes won by 'player'. 
+ *'state' is restored when it returns.
+ *
+ *UPDATE: Counts its scenes on 'ctx' and gives up (with a partial 
+ *count) when TimeOut() says so, since the tree is not pruned.
+*/
+int TallyVictories(SearchContext *ctx, RoundState *state, PLAYER player, int depth)
+{
+	int i, code;
+	int count = 0;
+	
+	if(TimeOut(ctx))
+	{
+		return 0;
+	}
+	
+	for(i=0; i<=MaxX; i++)
+	{
+		if(state->Height[i] == ColumnHeight)
+		{
+			continue;
+		}
+		
+		code = MakeMove(state, i, 0);
+		
+		if(code == (int)player)
+		{
+			count++;
+		}
+		else if(code == -1 && depth > 1)
+		{
+			count += TallyVictories(ctx, state, player, depth - 1);
+		}
+		
+		RetractMove(state, i, 0);
+		
+		if(ctx->Stop)
+		{
+			break;
+		}
+	}
+	
+	return count;
+}
+/* FindMaxVP()
+ *
+ *Secondary evaluation of DetermineBestMove(): among the moves 
+ *whose rating is 'score' after a 'depth' search, pick the one 
+ *with the highest VictoryProbability. 'state' is restored when 
+ *it returns.
+ *
+ *UPDATE: The counting stops at 'deadline' (0 for none) or at the 
+ *Signal of 'ctx', and then BestX of the search is kept as it is.
+*/
+int FindMaxVP(SearchContext *ctx, RoundState *state, int score, int depth, int BestX, long long deadline)
+{
+	int i, code, max = -1, SearchX = BestX;
+	PLAYER player = state->CurrentPlayer;
+	
+	ctx->Stop = false;
+	ctx->Deadline = deadline;
+	
+	for(i=0;i<=MaxX;i++)
+	{
+		if(state->Height[i] == ColumnHeight)
+		{
+			continue;
+		}
+		
+		code = MakeMove(state, i, 0);
+		if(-EvaluatePosition(ctx, state, code, depth - 1, -InfiniteScore, InfiniteScore) == score)
+		{
+			ctx->VictoryProbability[i] = (code == (int)player)?(1):(TallyVictories(ctx, state, player, depth - 1));
+			
+			// Find the maximum probability
+			if(ctx->VictoryProbability[i] > max)
+			{
+				max = ctx->VictoryProbability[i];
+				BestX = i;
+			}
+		}
+		RetractMove(state, i, 0);
+		
+		if(ctx->Stop)
+		{
+			BestX = SearchX;
+			break;
+		}
+	}
+	
+	ctx->Stop = false;
+	ctx->Deadline = 0;
+	
+	// Clean up VictoryProbability for the next round.
+	for(i=0;i<=MaxX;i++)
+	{
+		ctx->VictoryProbability[i] = 0;
+	}
+	
+	return BestX;
+}
+/* DeepenBestMove()
+ *
+ *Iterative Deepening: search 1 move deep, then 2, 3... until 
+ *DepthLimit is reached, a win or a loss is proven, or the 
+ *TimeBudget (milliseconds, 0 for no limit) runs out.
+ *
+ *An unfinished iteration is thrown away, so the best move always 
+ *comes from the last complete one. Depth 1 always completes, so 
+ *there is a move even with a tiny budget. The cheap iterations 
+ *also fill the Transposition Table for the deep ones.
+ *
+ *Returns the best move, *score is its Negamax score and 
+ **DepthReached the depth of the last complete iteration.
+*/
+int DeepenBestMove(SearchContext *ctx, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached)
+{
+	int BestX = -1, x;
+	int depth, rating;
+	long long deadline = (TimeBudget > 0)?(GetTimeMs() + TimeBudget):(0);
+	long long start, nodes;
+	
+	ctx->Nodes = 0;
+	ctx->Stop = false;
+	ctx->Deadline = 0;
+	AgeMoveOrder(ctx);
+	*score = 0;
+	*DepthReached = 0;
+	
+	for(depth=1; depth<=DepthLimit; depth++)
+	{
+		start = GetTimeMs();
+		nodes = ctx->Nodes;
+		
+		x = EvaluateBestMove(ctx, &state, &rating, depth, -InfiniteScore, InfiniteScore);
+		
+		StatIteration(ctx, depth, ctx->Nodes - nodes, GetTimeMs() - start);
+		
+		if(ctx->Stop)
+		{
+			break;
+		}
+		
+		BestX = x;
+		*score = rating;
+		*DepthReached = depth;
+		
+		// The result will not change any more
+		if(IsWinScore(rating) || IsWinScore(-rating) || depth >= BoardCells - state.Moves)
+		{
+			break;
+		}
+		
+		// From now on there is a move to fall back on
+		ctx->Deadline = deadline;
+		if(deadline != 0 && GetTimeMs() >= deadline)
+		{
+			break;
+		}
+	}
+	
+	ctx->Deadline = 0;
+	ctx->Stop = false;
+	
+	return BestX;
+}
+/* Root-Parallel Search
+ *
+ *The moves at the top of the search are shared out among several 
+ *workers, each simulating its moves with its own SearchContext 
+ *in its own thread. Besides the Transposition Table, the RootJob 
+ *is the only thing they share: a worker takes the next unclaimed 
+ *move from Next, and writes the rating of that move into Rating.
+ *
+ *Each move is rated with the full window, so it does not matter 
+ *which worker got it or which one finished first. The merge then 
+ *picks the best rating, and among equal ratings the earliest move 
+ *in Order, exactly like the serial search would.
+*/
+typedef struct
+{
+	RoundState State;
+	int Depth;
+	int Order[MaxX+1];
+	int Count;
+	int Rating[MaxX+1];
+	atomic_int Next;
+	atomic_bool Stopped;
+}RootJob;
+
+typedef struct
+{
+	RootJob *Job;
+	SearchContext *Context;
+}RootWorker;
+/* RootWorkerMain()
+ *
+ *What a worker does: rate moves of the job until none is left.
+*/
+ThreadRoutine(RootWorkerMain)
+{
+	RootWorker *worker = (RootWorker*)arg;
+	RootJob *job = worker->Job;
+	SearchContext *ctx = worker->Context;
+	RoundState state = job->State;
+	int n, x, code;
+	
+	while((n = atomic_fetch_add(&job->Next, 1)) < job->Count)
+	{
+		x = job->Order[n];
+		
+		code = MakeMove(&state, x, 0);
+		StatAdd(ctx, WinChecks, state.Moves >= FirstWinMove);
+		job->Rating[n] = -EvaluatePosition(ctx, &state, code, job->Depth - 1, -InfiniteScore, InfiniteScore);
+		RetractMove(&state, x, 0);
+		
+		if(ctx->Stop)
+		{
+			atomic_store(&job->Stopped, true);
+			break;
+		}
+	}
+	
+	ThreadReturn;
+}
+/* ParallelBestMove()
+ *
+ *DeepenBestMove() with the top moves shared among 'threads' 
+ *workers (see "Root-Parallel Search"). workers[] must hold at 
+ *least 'threads' contexts. The calling thread is worker 0.
+ *
+ *After each iteration, its best move is tried first in the next one.
+ *
+ *With a single worker, sharing is pointless and the moves at the 
+ *top would lose their pruning, so it is left to DeepenBestMove().
+*/
+int ParallelBestMove(SearchContext workers[], int threads, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached)
+{
+	RootJob job;
+	RootWorker worker[MaxX+1];
+	ThreadHandle thread[MaxX+1];
+	bool started[MaxX+1];
+	int BestX = -1;
+	int i, n, depth, best;
+	long long deadline = (TimeBudget > 0)?(GetTimeMs() + TimeBudget):(0);
+	long long start, nodes;
+	
+	if(threads <= 1)
+	{
+		return DeepenBestMove(&workers[0], state, score, DepthLimit, TimeBudget, DepthReached);
+	}
+	
+	*score = 0;
+	*DepthReached = 0;
+	
+	for(i=0;i<threads;i++)
+	{
+		workers[i].Nodes = 0;
+		workers[i].Stop = false;
+		workers[i].Deadline = 0;
+		AgeMoveOrder(&workers[i]);
+	}
+	
+	job.State = state;
+	job.Count = OrderMoves(&workers[0], &state, -1, job.Order);
+	
+	if(job.Count == 0)
+	{
+		return -1;
+	}
+	
+	// More workers than moves would have nothing to do
+	if(threads > job.Count)
+	{
+		threads = job.Count;
+	}
+	
+	for(i=0;i<threads;i++)
+	{
+		worker[i].Job = &job;
+		worker[i].Context = &workers[i];
+	}
+	
+	for(depth=1; depth<=DepthLimit; depth++)
+	{
+		job.Depth = depth;
+		atomic_store(&job.Next, 0);
+		atomic_store(&job.Stopped, false);
+		
+		start = GetTimeMs();
+		nodes = 0;
+		for(i=0;i<threads;i++)
+		{
+			nodes -= workers[i].Nodes;
+		}
+		
+		for(i=1;i<threads;i++)
+		{
+			started[i] = ThreadStart(&thread[i], RootWorkerMain, &worker[i]);
+		}
+		RootWorkerMain(&worker[0]);
+		for(i=1;i<threads;i++)
+		{
+			if(started[i])
+			{
+				ThreadJoin(thread[i]);
+			}
+		}
+		
+		for(i=0;i<threads;i++)
+		{
+			nodes += workers[i].Nodes;
+		}
+		StatIteration(&workers[0], depth, nodes, GetTimeMs() - start);
+		
+		if(atomic_load(&job.Stopped))
+		{
+			break;
+		}
+		
+		// Merge: the best rating, the earliest move among equals
+		best = 0;
+		for(n=1;n<job.Count;n++)
+		{
+			if(job.Rating[n] > job.Rating[best])
+			{
+				best = n;
+			}
+		}
+		
+		BestX = job.Order[best];
+		*score = job.Rating[best];
+		*DepthReached = depth;
+		
+		// Try the best move first in the next iteration
+		for(n=best;n>0;n--)
+		{
+			job.Order[n] = job.Order[n-1];
+		}
+		job.Order[0] = BestX;
+		
+		// The result will not change any more
+		if(IsWinScore(*score) || IsWinScore(-*score) || depth >= BoardCells - state.Moves)
+		{
+			break;
+		}
+		
+		// From now on there is a move to fall back on
+		for(i=0;i<threads;i++)
+		{
+			workers[i].Deadline = deadline;
+		}
+		if(deadline != 0 && GetTimeMs() >= deadline)
+		{
+			break;
+		}
+	}
+	
+	for(i=0;i<threads;i++)
+	{
+		workers[i].Deadline = 0;
+		workers[i].Stop = false;
+	}
+	
+	return BestX;
+}
+/* Lazy SMP Search
+ *
+ *All workers search the same top scene at the same time and share 
+ *one Transposition Table, so whatever one of them has evaluated is 
+ *a shortcut for the others. Worker 0 is the main worker and only 
+ *its result counts, the helpers are there to fill the table.
+ *
+ *To keep the helpers from walking the same tree in lock-step, 
+ *helper i starts its Iterative Deepening (i % 2) moves deeper and 
+ *uses a move order rotated by i (see Perturb in SearchContext). 
+ *When the main worker is done, it raises Done and the helpers stop.
+ *
+ *Unlike the Root-Parallel Search, it keeps scaling when there are 
+ *more workers than moves.
+*/
+typedef struct
+{
+	SearchContext *Context;
+	RoundState State;
+	int FirstDepth;
+	int DepthLimit;
+}LazyHelper;
+/* LazyHelperMain()
+ *
+ *What a helper does: deepen until it is told to stop.
+*/
+ThreadRoutine(LazyHelperMain)
+{
+	LazyHelper *helper = (LazyHelper*)arg;
+	SearchContext *ctx = helper->Context;
+	int depth, rating;
+	
+	ctx->Nodes = 0;
+	ctx->Stop = false;
+	ctx->Deadline = 0;
+	AgeMoveOrder(ctx);
+	
+	for(depth=helper->FirstDepth; depth<=helper->DepthLimit && !ctx->Stop; depth++)
+	{
+		EvaluateBestMove(ctx, &helper->State, &rating, depth, -InfiniteScore, InfiniteScore);
+	}
+	
+	ThreadReturn;
+}
+/* LazyBestMove()
+ *
+ *DeepenBestMove() of worker 0, helped by 'threads'-1 helpers 
+ *(see "Lazy SMP Search"). All workers[] must share one table.
+*/
+int LazyBestMove(SearchContext workers[], int threads, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached)
+{
+	atomic_bool done;
+	LazyHelper helper[MaxThreads];
+	ThreadHandle thread[MaxThreads];
+	bool started[MaxThreads];
+	int BestX, i;
+	
+	if(threads > MaxThreads)
+	{
+		threads = MaxThreads;
+	}
+	
+	atomic_init(&done, false);
+	
+	for(i=1;i<threads;i++)
+	{
+		workers[i].Signal = &done;
+		workers[i].Perturb = i;
+		helper[i].Context = &workers[i];
+		helper[i].State = state;
+		helper[i].FirstDepth = 1 + (i % 2);
+		helper[i].DepthLimit = DepthLimit;
+		started[i] = ThreadStart(&thread[i], LazyHelperMain, &helper[i]);
+	}
+	
+	BestX = DeepenBestMove(&workers[0], state, score, DepthLimit, TimeBudget, DepthReached);
+	
+	atomic_store(&done, true);
+	
+	for(i=1;i<threads;i++)
+	{
+		if(started[i])
+		{
+			ThreadJoin(thread[i]);
+		}
+		workers[i].Signal = NULL;
+		workers[i].Perturb = 0;
+	}
+	
+	return BestX;
+}
+/* EngineCreate()
+ *
+ *A new session (see EngineSession) with 'threads' workers, or one 
+ *per core if threads is 0, and a Transposition Table within 'memory' 
+ *bytes, or TTMemory if memory is 0. It thinks in the Lazy SMP way 
+ *and has no Opening Book. Returns NULL if there is no memory for it.
+ *
+ *Old EngineInit(), which set up the only session of the program.
+*/
+EngineSession* EngineCreate(int threads, size_t memory)
+{
+	EngineSession *engine;
+	int i;
+	
+	if(threads <= 0)
+	{
+		threads = CountCores();
+	}
+	if(threads > MaxThreads)
+	{
+		threads = MaxThreads;
+	}
+	
+	engine = (EngineSession*)calloc(1, sizeof(EngineSession));
+	if(engine == NULL)
+	{
+		return NULL;
+	}
+	engine->Workers = (SearchContext*)calloc(threads, sizeof(SearchContext));
+	if(engine->Workers == NULL)
+	{
+		free(engine);
+		return NULL;
+	}
+	
+	InitZobrist();
+	InitEvaluation();
+	
+	TTInit(&engine->Table, (memory > 0)?(memory):(TTMemory));
+	
+	for(i=0;i<threads;i++)
+	{
+		SearchContextInit(&engine->Workers[i], &engine->Table);
+		engine->Workers[i].PV = &engine->PV;
+	}
+	
+	memset(engine->PV.Move, -1, sizeof(engine->PV.Move));
+	engine->Threads = threads;
+	engine->Parallel = PARALLEL_LAZY;
+	
+	return engine;
+}
+/* EngineDestroy()
+ *
+ *Stop the pondering of 'engine', if any, and give it back.
+*/
+void EngineDestroy(EngineSession *engine)
+{
+	if(engine == NULL)
+	{
+		return;
+	}
+	
+	PonderStop(engine);
+	free(engine->Table.Entries);
+	free(engine->Tree.Nodes);
+	free(engine->Workers);
+	free(engine);
+}
+/* EngineNewGame()
+ *
+ *A new game starts with an empty Transposition Table, and nothing 
+ *learned by the Move Ordering.
+*/
+void EngineNewGame(EngineSession *engine)
+{
+	int i;
+	
+	TTClear(&engine->Table);
+	
+	for(i=0;i<engine->Threads;i++)
+	{
+		ClearMoveOrder(&engine->Workers[i]);
+	}
+	
+	memset(engine->PV.Key, 0, sizeof(engine->PV.Key));
+	memset(engine->PV.Move, -1, sizeof(engine->PV.Move));
+}
+/* EngineSavePV()
+ *
+ *Follow the best moves from 'state' as far as the Transposition 
+ *Table knows them, and keep them as the Principal Variation.
+*/
+void EngineSavePV(EngineSession *engine, RoundState state)
+{
+	TTEntry entry;
+	int n;
+	
+	for(n=state.Moves;n<=BoardCells;n++)
+	{
+		engine->PV.Key[n] = 0;
+		engine->PV.Move[n] = -1;
+	}
+	
+	while(state.Moves < BoardCells && TTProbe(&engine->Table, state.Hash, &entry) 
+	      && entry.BestMove != -1 && state.Height[entry.BestMove] < ColumnHeight)
+	{
+		engine->PV.Key[state.Moves] = state.Hash;
+		engine->PV.Move[state.Moves] = entry.BestMove;
+		
+		// Nothing follows a win
+		if(MakeMove(&state, entry.BestMove, 0) != -1)
+		{
+			break;
+		}
+	}
+}
+/* CollectStats()
+ *
+ *Add up the Search Statistics of 'threads' workers into 'stats'. 
+ *The iterations are those of worker 0, which leads the search.
+*/
+void CollectStats(SearchStats *stats, SearchContext workers[], int threads, long long time)
+{
+	int i;
+	
+	*stats = workers[0].Stats;
+	stats->Nodes = workers[0].Nodes;
+	
+	for(i=1;i<threads;i++)
+	{
+		stats->Nodes += workers[i].Nodes;
+		stats->Interior += workers[i].Stats.Interior;
+		stats->Leaves += workers[i].Stats.Leaves;
+		stats->WinChecks += workers[i].Stats.WinChecks;
+		stats->Cutoffs += workers[i].Stats.Cutoffs;
+		stats->FirstCutoffs += workers[i].Stats.FirstCutoffs;
+		stats->TTHits += workers[i].Stats.TTHits;
+		stats->TTMisses += workers[i].Stats.TTMisses;
+	}
+	
+	stats->Time = time;
+	stats->FromBook = false;
+	stats->Threads = threads;
+	stats->TreeNodes = 0;
+}
+/* EngineBestMove()
+ *
+ *Search with the session 'engine' in its Parallel way, the other 
+ *parameters are those of DeepenBestMove().
+ *
+ *UPDATE: Fills the Stats of the session.
+ *
+ *UPDATE: Each call is a new Generation of the table, and leaves 
+ *its Principal Variation in the PV of the session.
+*/
+int EngineBestMove(EngineSession *engine, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached)
+{
+	int BestX;
+	long long start = GetTimeMs();
+	
+	TTNewSearch(&engine->Table);
+	
+	if(engine->Parallel == PARALLEL_ROOT)
+	{
+		BestX = ParallelBestMove(engine->Workers, engine->Threads, state, score, DepthLimit, TimeBudget, DepthReached);
+	}
+	else
+	{
+		BestX = LazyBestMove(engine->Workers, engine->Threads, state, score, DepthLimit, TimeBudget, DepthReached);
+	}
+	
+	CollectStats(&engine->Stats, engine->Workers, engine->Threads, GetTimeMs() - start);
+	engine->Stats.Move = BestX;
+	engine->Stats.Score = *score;
+	EngineSavePV(engine, state);
+	
+	return BestX;
+}
+/* Batched Playouts
+ *
+ *A random game is a chain: every move depends on the one before, 
+ *and so does the check for a win. Independent games have no such 
+ *chain between them, so a PlayoutBatch plays PlayoutLanes of them 
+ *side by side, one move of every game (lane) at each step.
+ *
+ *The lanes are laid out one array per member, and each part of a 
+ *step is a loop over the lanes with no branches in it: where C would 
+ *branch, a lane computes a mask and selects with it. That is the 
+ *shape compilers turn into SIMD instructions by themselves (e.g. 
+ *gcc -O3 -march=native runs 4 times as many games per second as 
+ *one game at a time), with no intrinsics, so it is still plain C 
+ *on any other compiler or processor.
+ *
+ *Each lane:
+ * - Draws from its own xorshift32 generator, shifts and XORs only.
+ * - Finds the lowest empty block of every open column at once, 
+ *   (all + BottomRow) & BoardMask, and keeps the r-th of them, r 
+ *   uniform in [0, n): no column is ever drawn and rejected. n is 
+ *   counted by LaneCount(), which needs no popcount instruction.
+ * - Checks the board for a win with the shifts of StrandStarts().
+ * - When its game is over, counts the result and starts the next 
+ *   game from the same scene, until it has played its share.
+*/
+/* LaneCount()
+ *
+ *CountChess() with shifts and adds only.
+*/
+static inline Bitboard LaneCount(Bitboard b)
+{
+	uint64_t v = (uint64_t)b;
+	
+	v = v - ((v >> 1) & 0x5555555555555555ULL);
+	v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+	v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	v += v >> 8;
+	v += v >> 16;
+	v += v >> 32;
+	
+	return (Bitboard)(v & 0x7F);
+}
+/* PlayoutSeed()
+ *
+ *Give every lane of 'batch' a generator of its own, from 'seed'.
+*/
+void PlayoutSeed(PlayoutBatch *batch, uint64_t seed)
+{
+	int i;
+	
+	for(i=0;i<PlayoutLanes;i++)
+	{
+		// xorshift32 must not start at 0
+		batch->Seed[i] = (uint32_t)SplitMix64(&seed) | 1;
+	}
+}
+/* PlayoutBatchRun()
+ *
+ *Play 'games' random games from the scene where 'mine' are the 
+ *chess of the player to move. tally[2] is the number of games that 
+ *player wins, tally[1] the ties and tally[0] the losses.
+*/
+void PlayoutBatchRun(PlayoutBatch *batch, Bitboard mine, Bitboard theirs, int games, int tally[3])
+{
+	Bitboard open[PlayoutLanes], pick[PlayoutLanes], board[PlayoutLanes], strand[PlayoutLanes], won[PlayoutLanes];
+	Bitboard live, over, restart, busy;
+	uint32_t x;
+	int i, k, m, n;
+	
+	for(i=0;i<PlayoutLanes;i++)
+	{
+		batch->Mine[i] = mine;
+		batch->Theirs[i] = theirs;
+		batch->Side[i] = 0;
+		batch->Left[i] = (Bitboard)(games / PlayoutLanes + (i < games % PlayoutLanes));
+		batch->Wins[i] = 0;
+		batch->Ties[i] = 0;
+	}
+	
+	do
+	{
+		// The lowest empty blocks, and how many of them to strike off
+		for(i=0;i<PlayoutLanes;i++)
+		{
+			live = (Bitboard)0 - (Bitboard)(batch->Left[i] != 0);
+			open[i] = ((batch->Mine[i] | batch->Theirs[i]) + BottomRow) & BoardMask & live;
+			
+			x = batch->Seed[i];
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			batch->Seed[i] = x;
+			pick[i] = (Bitboard)(((uint64_t)x * (uint64_t)LaneCount(open[i])) >> 32);
+		}
+		for(k=0;k<MaxX;k++)
+		{
+			for(i=0;i<PlayoutLanes;i++)
+			{
+				live = (Bitboard)0 - (Bitboard)(pick[i] != 0);
+				open[i] &= (open[i] - 1) | ~live;
+				pick[i] -= live & 1;
+			}
+		}
+		for(i=0;i<PlayoutLanes;i++)
+		{
+			board[i] = batch->Mine[i] | (open[i] & (~open[i] + 1));
+			won[i] = 0;
+		}
+		
+		// Alignment(), lane by lane
+		for(m=0;m<4;m++)
+		{
+			for(i=0;i<PlayoutLanes;i++)
+			{
+				strand[i] = board[i];
+			}
+			for(n=1; 2*n<=ConnectLength; n*=2)
+			{
+				for(i=0;i<PlayoutLanes;i++)
+				{
+					strand[i] &= strand[i] >> (n*Direction[m]);
+				}
+			}
+			if(n < ConnectLength)
+			{
+				for(i=0;i<PlayoutLanes;i++)
+				{
+					strand[i] &= strand[i] >> ((ConnectLength-n)*Direction[m]);
+				}
+			}
+			for(i=0;i<PlayoutLanes;i++)
+			{
+				won[i] |= strand[i];
+			}
+		}
+		
+		// Count a finished game, and start the next one
+		busy = 0;
+		for(i=0;i<PlayoutLanes;i++)
+		{
+			live = (Bitboard)0 - (Bitboard)(batch->Left[i] != 0);
+			won[i] = (Bitboard)0 - (Bitboard)(won[i] != 0);
+			over = live & (won[i] | ((Bitboard)0 - (Bitboard)(open[i] == 0)));
+			
+			batch->Wins[i] += over & won[i] & ~batch->Side[i] & 1;
+			batch->Ties[i] += over & ~won[i] & 1;
+			batch->Left[i] -= over & 1;
+			restart = over & ((Bitboard)0 - (Bitboard)(batch->Left[i] != 0));
+			
+			batch->Mine[i] = (mine & restart) | (batch->Theirs[i] & ~restart);
+			batch->Theirs[i] = (theirs & restart) | (board[i] & ~restart);
+			batch->Side[i] = ~batch->Side[i] & ~restart;
+			busy |= batch->Left[i];
+		}
+	}while(busy != 0);
+	
+	tally[1] = 0;
+	tally[2] = 0;
+	for(i=0;i<PlayoutLanes;i++)
+	{
+		tally[2] += (int)batch->Wins[i];
+		tally[1] += (int)batch->Ties[i];
+	}
+	tally[0] = games - tally[1] - tally[2];
+}
+/* AnalyzeScenes()
+ *
+ *Analyse 'count' scenes into results[], see "Batch Analysis".
+*/
+void AnalyzeScenes(const SceneBoards *scenes, SceneAnalysis *results, size_t count)
+{
+	Bitboard board[2][AnalysisLanes], threat[2][AnalysisLanes], strand[AnalysisLanes];
+	Bitboard open[AnalysisLanes], aligned[2][AnalysisLanes], wins[AnalysisLanes], blocks[AnalysisLanes];
+	Bitboard ahead[ConnectLength][AnalysisLanes], behind[ConnectLength][AnalysisLanes];
+	Bitboard pick;
+	size_t base;
+	int i, j, k, m, p, n, lanes;
+	
+	for(base=0; base<count; base+=AnalysisLanes)
+	{
+		lanes = (count - base < AnalysisLanes)?((int)(count - base)):(AnalysisLanes);
+		
+		// The player to move is board[0], the unused lanes are empty
+		for(i=0;i<AnalysisLanes;i++)
+		{
+			if(i < lanes)
+			{
+				pick = (Bitboard)0 - (Bitboard)(scenes[base+i].ToMove == PLAYER_B);
+				board[0][i] = (scenes[base+i].Board[1] & pick) | (scenes[base+i].Board[0] & ~pick);
+				board[1][i] = (scenes[base+i].Board[0] & pick) | (scenes[base+i].Board[1] & ~pick);
+			}
+			else
+			{
+				board[0][i] = 0;
+				board[1][i] = 0;
+			}
+			open[i] = ((board[0][i] | board[1][i]) + BottomRow) & BoardMask;
+		}
+		
+		for(p=0;p<2;p++)
+		{
+			for(i=0;i<AnalysisLanes;i++)
+			{
+				aligned[p][i] = 0;
+				threat[p][i] = 0;
+			}
+			
+			for(m=0;m<4;m++)
+			{
+				// Alignment()
+				for(i=0;i<AnalysisLanes;i++)
+				{
+					strand[i] = board[p][i];
+				}
+				for(n=1; 2*n<=ConnectLength; n*=2)
+				{
+					for(i=0;i<AnalysisLanes;i++)
+					{
+						strand[i] &= strand[i] >> (n*Direction[m]);
+					}
+				}
+				if(n < ConnectLength)
+				{
+					for(i=0;i<AnalysisLanes;i++)
+					{
+						strand[i] &= strand[i] >> ((ConnectLength-n)*Direction[m]);
+					}
+				}
+				for(i=0;i<AnalysisLanes;i++)
+				{
+					aligned[p][i] |= strand[i];
+				}
+				
+				// Taken blocks up to j steps ahead / behind
+				for(i=0;i<AnalysisLanes;i++)
+				{
+					ahead[0][i] = BoardMask;
+					behind[0][i] = BoardMask;
+				}
+				for(j=1;j<ConnectLength;j++)
+				{
+					for(i=0;i<AnalysisLanes;i++)
+					{
+						ahead[j][i] = ahead[j-1][i] & (board[p][i] >> (j*Direction[m]));
+						behind[j][i] = behind[j-1][i] & (board[p][i] << (j*Direction[m]));
+					}
+				}
+				
+				// The gap at k of the strand
+				for(k=0;k<ConnectLength;k++)
+				{
+					for(i=0;i<AnalysisLanes;i++)
+					{
+						threat[p][i] |= behind[k][i] & ahead[ConnectLength-1-k][i];
+					}
+				}
+			}
+		}
+		
+		// The blocks that can be taken now, column by column
+		for(i=0;i<AnalysisLanes;i++)
+		{
+			pick = (Bitboard)0 - (Bitboard)((aligned[0][i] | aligned[1][i]) == 0);
+			threat[0][i] &= open[i] & pick;
+			threat[1][i] &= open[i] & pick;
+			wins[i] = 0;
+			blocks[i] = 0;
+		}
+		for(m=0;m<=MaxX;m++)
+		{
+			for(i=0;i<AnalysisLanes;i++)
+			{
+				wins[i] |= (Bitboard)((threat[0][i] & ColumnMask(m)) != 0) << m;
+				blocks[i] |= (Bitboard)((threat[1][i] & ColumnMask(m)) != 0) << m;
+			}
+		}
+		
+		for(i=0;i<lanes;i++)
+		{
+			pick = (Bitboard)(scenes[base+i].ToMove == PLAYER_B);
+			results[base+i].Winner = (aligned[0][i] != 0)?((pick)?(PLAYER_B):(PLAYER_A)):
+			                         ((aligned[1][i] != 0)?((pick)?(PLAYER_A):(PLAYER_B)):(-1));
+			results[base+i].Wins = (uint16_t)wins[i];
+			results[base+i].Blocks = (uint16_t)blocks[i];
+		}
+	}
+}
+/* Monte Carlo Tree Search
+ *
+ *Another way for the computer to think, which needs no Static 
+ *Evaluation at all: UCT. A tree of scenes grows from the top scene, 
+ *one simulation at a time:
+ * 1. Selection   - From the top, step into the child with the best 
+ *                  UCT value (see MctsSelect()), until a scene 
+ *                  without children is reached.
+ * 2. Expansion   - Once that scene has been visited MctsExpandVisits 
+ *                  times, its children are created.
+ * 3. Simulation  - MctsLeafGames random games are played from the 
+ *                  scene at once, see "Batched Playouts".
+ * 4. Backpropagation - The result is added to every scene of the path.
+ *The move made is the child of the top scene visited most often.
+ *
+ *Visits counts the random games played below a node, and Wins 
+ *their results in half points (2 for a win, 1 for a tie) for the 
+ *player who made the move leading to it, so each scene picks the 
+ *child that is best for the player to move there.
+ *
+ *Node Pool: All nodes come from one array of MctsMemory, allocated 
+ *once by MctsInit() and used again by every search. The children of 
+ *a node lie next to each other, Child is the index of the first one 
+ *and Count their number. When the pool is full, the tree stops 
+ *growing but the simulations go on.
+ *
+ *Threads: Any number of threads grow the same tree without locks, 
+ *Visits and Wins are atomic counters. On its way down, a thread adds 
+ *the visits of its games plus MctsVirtualLoss, but no win, to each 
+ *node of its path, and on its way up takes back the virtual ones: 
+ *until then, the path looks worse to the others, so they spread 
+ *out over the tree. Only 
+ *the thread that turns Child from 0 into MctsExpanding creates the 
+ *children, the others simulate from the node meanwhile.
+*/
+#define MctsMemory       (64 * 1024 * 1024)
+#define MctsExplore      1.4
+#define MctsLeafGames    PlayoutLanes
+#define MctsExpandVisits MctsLeafGames
+#define MctsVirtualLoss  2
+#define MctsExpanding    -1
+#define MctsTimeCheck    64 // Simulations between two looks at the clock
+
+typedef struct
+{
+	MctsPool *Pool;
+	RoundState State;
+	long long Deadline;
+}MctsJob;
+
+typedef struct
+{
+	MctsJob *Job;
+	PlayoutBatch Batch;
+}MctsWorker;
+
+/* MctsInit()
+ *
+ *Allocate the pool within 'bytes' of memory, once.
+*/
+bool MctsInit(MctsPool *pool, size_t bytes)
+{
+	if(pool->Nodes == NULL)
+	{
+		pool->Capacity = (int)(bytes / sizeof(MctsNode));
+		pool->Nodes = (MctsNode*)calloc(pool->Capacity, sizeof(MctsNode));
+	}
+	
+	return pool->Nodes != NULL;
+}
+/* MctsSelect()
+ *
+ *The child of 'node' with the best UCT value for the player to 
+ *move there:
+ *
+ *  Wins / (2 * Visits) + MctsExplore * sqrt(ln(Visits of node) / Visits)
+ *
+ *A child that has never been visited goes first.
+*/
+int MctsSelect(MctsNode *nodes, int node, int child)
+{
+	int i, visits, best = child;
+	double value, top = -1.0;
+	double explore = MctsExplore * sqrt(log((double)atomic_load_explicit(&nodes[node].Visits, memory_order_relaxed)));
+	
+	for(i=child; i<child+nodes[node].Count; i++)
+	{
+		visits = atomic_load_explicit(&nodes[i].Visits, memory_order_relaxed);
+		if(visits == 0)
+		{
+			return i;
+		}
+		
+		value = atomic_load_explicit(&nodes[i].Wins, memory_order_relaxed) / (2.0 * visits) 
+		      + explore / sqrt((double)visits);
+		if(value > top)
+		{
+			top = value;
+			best = i;
+		}
+	}
+	
+	return best;
+}
+/* MctsExpand()
+ *
+ *Create the children of 'node', whose scene is 'state', unless 
+ *another thread is at it or the pool is full.
+*/
+void MctsExpand(MctsPool *pool, int node, const RoundState *state)
+{
+	MctsNode *nodes = pool->Nodes;
+	int expected = 0, first, count = 0, i, x;
+	
+	if(!atomic_compare_exchange_strong(&nodes[node].Child, &expected, MctsExpanding))
+	{
+		return;
+	}
+	
+	for(x=0;x<=MaxX;x++)
+	{
+		count += (state->Height[x] < ColumnHeight);
+	}
+	
+	// Once full, the pool is not even asked any more
+	if(atomic_load(&pool->Used) + count > pool->Capacity 
+	   || (first = atomic_fetch_add(&pool->Used, count)) + count > pool->Capacity)
+	{
+		atomic_store(&nodes[node].Child, 0);
+		return;
+	}
+	
+	for(i=0, x=0; i<=MaxX; i++)
+	{
+		if(state->Height[CenterOrder(i)] < ColumnHeight)
+		{
+			atomic_init(&nodes[first + x].Visits, 0);
+			atomic_init(&nodes[first + x].Wins, 0);
+			atomic_init(&nodes[first + x].Child, 0);
+			nodes[first + x].Move = (int8_t)CenterOrder(i);
+			nodes[first + x].Count = 0;
+			x++;
+		}
+	}
+	nodes[node].Count = (int8_t)count;
+	
+	// The children are ready before anybody can see them
+	atomic_store(&nodes[node].Child, first);
+}
+/* MctsWorkerMain()
+ *
+ *What a thread does: simulate until the deadline.
+*/
+ThreadRoutine(MctsWorkerMain)
+{
+	MctsWorker *worker = (MctsWorker*)arg;
+	MctsJob *job = worker->Job;
+	MctsNode *nodes = job->Pool->Nodes;
+	RoundState state;
+	int path[BoardCells+1];
+	int n, depth, node, child, code, result, tally[3];
+	
+	do
+	{
+		for(n=0;n<MctsTimeCheck;n++)
+		{
+			state = job->State;
+			node = 0;
+			depth = 0;
+			path[0] = 0;
+			code = -1;
+			atomic_fetch_add(&nodes[0].Visits, MctsLeafGames + MctsVirtualLoss);
+			
+			// Selection
+			while(code == -1 && (child = atomic_load(&nodes[node].Child)) > 0)
+			{
+				node = MctsSelect(nodes, node, child);
+				atomic_fetch_add(&nodes[node].Visits, MctsLeafGames + MctsVirtualLoss);
+				path[++depth] = node;
+				code = MakeMove(&state, nodes[node].Move, 0);
+			}
+			
+			// Expansion
+			if(code == -1 && state.Moves < BoardCells 
+			   && atomic_load(&nodes[node].Visits) >= MctsExpandVisits)
+			{
+				MctsExpand(job->Pool, node, &state);
+			}
+			
+			// Simulation, for the player who moved into 'node'
+			if(code != -1)
+			{
+				result = 2*MctsLeafGames;
+			}
+			else if(state.Moves == BoardCells)
+			{
+				result = MctsLeafGames;
+			}
+			else
+			{
+				PlayoutBatchRun(&worker->Batch, state.Board[state.CurrentPlayer-1], 
+				                state.Board[Opponent(state.CurrentPlayer)-1], MctsLeafGames, tally);
+				result = 2*tally[0] + tally[1];
+			}
+			
+			// Backpropagation
+			for(; depth>=0; depth--)
+			{
+				atomic_fetch_add(&nodes[path[depth]].Wins, result);
+				atomic_fetch_sub(&nodes[path[depth]].Visits, MctsVirtualLoss);
+				result = 2*MctsLeafGames - result;
+			}
+		}
+	}while(GetTimeMs() < job->Deadline);
+	
+	ThreadReturn;
+}
+/* MonteCarloBestMove()
+ *
+ *Think about 'state' with the Monte Carlo Tree Search, on 
+ *'threads' threads for TimeBudget milliseconds. Returns the move, 
+ **visits is the number of random games played. The pool is allocated 
+ *at the first call; without it, the first open column is returned.
+ *
+ *The top scene is expanded at once, so every move has a node even 
+ *when the budget is tiny.
+ *
+ *UPDATE: The tree is the Tree of the session 'engine', and the 
+ *Stats of the session tell how the decision was made.
+*/
+int MonteCarloBestMove(EngineSession *engine, RoundState state, int TimeBudget, int threads, long long *visits)
+{
+	MctsJob job;
+	MctsWorker worker[MaxThreads];
+	ThreadHandle thread[MaxThreads];
+	bool started[MaxThreads];
+	MctsNode *nodes;
+	int BestX = -1, i, child, most = -1;
+	long long start = GetTimeMs();
+	
+	*visits = 0;
+	
+	if(threads < 1)
+	{
+		threads = 1;
+	}
+	if(threads > MaxThreads)
+	{
+		threads = MaxThreads;
+	}
+	
+	if(MctsInit(&engine->Tree, MctsMemory))
+	{
+		nodes = engine->Tree.Nodes;
+		atomic_init(&nodes[0].Visits, 0);
+		atomic_init(&nodes[0].Wins, 0);
+		atomic_init(&nodes[0].Child, 0);
+		nodes[0].Move = -1;
+		nodes[0].Count = 0;
+		atomic_store(&engine->Tree.Used, 1);
+		MctsExpand(&engine->Tree, 0, &state);
+		
+		job.Pool = &engine->Tree;
+		job.State = state;
+		job.Deadline = start + TimeBudget;
+		
+		for(i=0;i<threads;i++)
+		{
+			worker[i].Job = &job;
+			PlayoutSeed(&worker[i].Batch, state.Hash ^ (uint64_t)i);
+		}
+		for(i=1;i<threads;i++)
+		{
+			started[i] = ThreadStart(&thread[i], MctsWorkerMain, &worker[i]);
+		}
+		MctsWorkerMain(&worker[0]);
+		for(i=1;i<threads;i++)
+		{
+			if(started[i])
+			{
+				ThreadJoin(thread[i]);
+			}
+		}
+		
+		// The most visited move
+		child = atomic_load(&nodes[0].Child);
+		for(i=child; child > 0 && i<child+nodes[0].Count; i++)
+		{
+			if(atomic_load(&nodes[i].Visits) > most)
+			{
+				most = atomic_load(&nodes[i].Visits);
+				BestX = nodes[i].Move;
+			}
+		}
+		
+		*visits = atomic_load(&nodes[0].Visits);
+	}
+	
+	for(i=0; i<=MaxX && BestX == -1; i++)
+	{
+		BestX = (state.Height[i] < ColumnHeight)?(i):(-1);
+	}
+	
+	memset(&engine->Stats, 0, sizeof(engine->Stats));
+	engine->Stats.Nodes = *visits;
+	engine->Stats.Time = GetTimeMs() - start;
+	engine->Stats.Move = BestX;
+	engine->Stats.Threads = threads;
+	engine->Stats.TreeNodes = (engine->Tree.Nodes != NULL)?(atomic_load(&engine->Tree.Used)):(0);
+	
+	return BestX;
+}
+/* BookAttach()
+ *
+ *Use the 'size' bytes at 'data', a book file in memory, as 'book'. 
+ *Returns false, and leaves the book empty, if it does not fit this 
+ *program. The memory stays the caller's and must outlive the book.
+*/
+bool BookAttach(OpeningBook *book, const void *data, size_t size)
+{
+	const BookHeader *header = (const BookHeader*)data;
+	
+	book->Header = NULL;
+	book->Entries = NULL;
+	book->Size = 0;
+	
+	InitZobrist();
+	
+	if(header == NULL || size < sizeof(BookHeader) 
+	   || memcmp(header->Magic, BookMagic, sizeof(BookMagic)) != 0 
+	   || header->Width != MaxX+1 || header->Height != MaxY+1 
+	   || header->Signature != ZobristKey[0][0] 
+	   || header->Slots == 0 || (header->Slots & (header->Slots - 1)) != 0 
+	   || header->Slots > (size - sizeof(BookHeader)) / sizeof(BookEntry) 
+	   || size != sizeof(BookHeader) + header->Slots * sizeof(BookEntry))
+	{
+		return false;
+	}
+	
+	book->Header = header;
+	book->Entries = (const BookEntry*)(header + 1);
+	book->Size = size;
+	
+	return true;
+}
+/* BookProbe()
+ *
+ *Look up the scene with Hash 'key'. Returns false if it is not 
+ *in the book.
+ *
+ *UPDATE: At most Slots entries are looked at, so a table without 
+ *an empty entry cannot keep it going round.
+*/
+bool BookProbe(const OpeningBook *book, uint64_t key, int *move, int *score, int *depth)
+{
+	uint64_t mask, i, n;
+	
+	if(book->Header == NULL)
+	{
+		return false;
+	}
+	
+	mask = book->Header->Slots - 1;
+	
+	for(i = key & mask, n = 0; n < book->Header->Slots && book->Entries[i].Move != -1; i = (i + 1) & mask, n++)
+	{
+		if(book->Entries[i].Key == key)
+		{
+			*move = book->Entries[i].Move;
+			*score = book->Entries[i].Score;
+			*depth = book->Entries[i].Depth;
+			return true;
+		}
+	}
+	
+	return false;
+}
+/* BookHit()
+ *
+ *Look 'state' up in the Opening Book of 'engine', if it has one. 
+ *On a hit, the Stats of the session tell so.
+*/
+bool BookHit(EngineSession *engine, const RoundState *state, int *move, int *score, int *depth)
+{
+	if(engine->Book == NULL || !BookProbe(engine->Book, state->Hash, move, score, depth))
+	{
+		return false;
+	}
+	
+	memset(&engine->Stats, 0, sizeof(engine->Stats));
+	engine->Stats.FromBook = true;
+	engine->Stats.Move = *move;
+	engine->Stats.Score = *score;
+	
+	return true;
+}
+/* DetermineBestMove()
+ *
+ *It is an external packer function to make a final 
+ *decision through considering ratings from primary 
+ *and secondary rating system.
+ *
+ *The concept is: because of the limitation of depth 
+ *value, many scenes might not reveal a result. This 
+ *time the primary evaluation will always return 
+ *NeutralPosition. Then we need the secondary evaluation. 
+ *
+ *VictoryProbability stores the total number of scenes of 
+ *WinPosition for each point where you can make the move.
+ *A higher number stands for a higher chance you are going 
+ *to win finally.
+ *
+ *UPDATE: With VictoryTieBreak, only the moves that are as 
+ *good as the best one in the Primary Evaluation compete in 
+ *the secondary evaluation, so each of them is rated with 
+ *the full window.
+ *
+ *UPDATE: Searches MaxDepth moves deep, however long it takes. 
+ *See DetermineBestMoveTimed() for a time limit instead.
+ *
+ *UPDATE: Thinks with the session 'engine', on all its workers.
+ *
+ *UPDATE: A scene in the Opening Book is answered without a search.
+ *
+ *UPDATE: The Stats of the session tell how the decision was made.
+*/
+int DetermineBestMove(EngineSession *engine, RoundState state, int *MoveRating)
+{
+	int BestX;
+	int score, depth;
+	
+	if(BookHit(engine, &state, &BestX, &score, &depth))
+	{
+		*MoveRating = RatingOf(score);
+		return BestX;
+	}
+	
+	BestX = EngineBestMove(engine, state, &score, MaxDepth, 0, &depth);
+	
+#if VictoryTieBreak
+	if(RatingOf(score) == NeutralPosition)
+	{
+		BestX = FindMaxVP(&engine->Workers[0], &state, score, depth, BestX, 0);
+		engine->Stats.Move = BestX;
+	}
+#endif
+	
+	*MoveRating = RatingOf(score);
+	
+	return BestX;
+}
+/* DetermineBestMoveTimed()
+ *
+ *Same as DetermineBestMove(), but it searches as deep as it can 
+ *within TimeBudget milliseconds. *DepthReached reports how deep 
+ *the chosen move has been searched.
+ *
+ *UPDATE: The VictoryTieBreak keeps to the same budget.
+*/
+int DetermineBestMoveTimed(EngineSession *engine, RoundState state, int *MoveRating, int TimeBudget, int *DepthReached)
+{
+	int BestX;
+	int score;
+#if VictoryTieBreak
+	long long deadline = (TimeBudget > 0)?(GetTimeMs() + TimeBudget):(0);
+#endif
+	
+	if(BookHit(engine, &state, &BestX, &score, DepthReached))
+	{
+		*MoveRating = RatingOf(score);
+		return BestX;
+	}
+	
+	BestX = EngineBestMove(engine, state, &score, BoardCells - state.Moves, TimeBudget, DepthReached);
+	
+#if VictoryTieBreak
+	if(RatingOf(score) == NeutralPosition)
+	{
+		BestX = FindMaxVP(&engine->Workers[0], &state, score, *DepthReached, BestX, deadline);
+		engine->Stats.Move = BestX;
+	}
+#endif
+	
+	*MoveRating = RatingOf(score);
+	
+	return BestX;
+}
+/* Pondering
+ *
+ *While the human thinks, the computer does not have to wait. 
+ *PonderStart() guesses the reply of the human and searches the 
+ *scene after it with the session, in a thread of its own, while 
+ *the game loop is waiting for the input.
+ *
+ *The guess is the move the last search of the computer expected 
+ *(its Principal Variation, or else the best move the Transposition 
+ *Table remembers), or else the most central column that is not full.
+ *
+ *When the human has moved, PonderReply() answers:
+ * Hit  - The human played the guess. The search already running 
+ *        is the search the computer would start now, so it just 
+ *        goes on until the time budget, counted from when the 
+ *        pondering started, is used up. If the human thought 
+ *        longer than that, the move is there at once.
+ * Miss - The pondering is stopped and the computer thinks as 
+ *        usual, but the table already knows much of the tree.
+ *
+ *Either way the answer is searched at least as deep as without 
+ *pondering. The session may not be used by anyone else between 
+ *PonderStart() and PonderStop(); the Ponder of the session keeps 
+ *the state of the pondering.
+*/
+#define PonderPoll 5 // Milliseconds between two looks at a hit
+/* PonderMain()
+ *
+ *The pondering thread: deepen on the guessed scene until the 
+ *result is proven or it is told to stop.
+*/
+ThreadRoutine(PonderMain)
+{
+	EngineSession *engine = (EngineSession*)arg;
+	Ponder *ponder = &engine->Ponder;
+	
+	ponder->BestX = EngineBestMove(engine, ponder->State, &ponder->Score, BoardCells - ponder->State.Moves, 0, &ponder->Depth);
+	atomic_store(&ponder->Done, true);
+	
+	ThreadReturn;
+}
+/* PonderStart()
+ *
+ *Start pondering on the reply to 'state', where it is the 
+ *human's turn. Nothing happens if the guessed move ends the 
+ *game, or the Opening Book already knows the answer.
+*/
+void PonderStart(EngineSession *engine, const RoundState *state)
+{
+	Ponder *ponder = &engine->Ponder;
+	TTEntry entry;
+	int guess = -1, i, move, score, depth;
+	
+	if(engine->PV.Key[state->Moves] == state->Hash && engine->PV.Move[state->Moves] != -1)
+	{
+		guess = engine->PV.Move[state->Moves];
+	}
+	else if(TTProbe(&engine->Table, state->Hash, &entry) && entry.BestMove != -1 
+	        && state->Height[entry.BestMove] < ColumnHeight)
+	{
+		guess = entry.BestMove;
+	}
+	for(i=0; i<=MaxX && guess == -1; i++)
+	{
+		if(state->Height[CenterOrder(i)] < ColumnHeight)
+		{
+			guess = CenterOrder(i);
+		}
+	}
+	if(guess == -1)
+	{
+		return;
+	}
+	
+	ponder->State = *state;
+	if(MakeMove(&ponder->State, guess, CalculateCoordinateY(state, guess)) != -1 
+	   || ponder->State.Moves == BoardCells 
+	   || (engine->Book != NULL && BookProbe(engine->Book, ponder->State.Hash, &move, &score, &depth)))
+	{
+		return;
+	}
+	
+	for(i=0;i<engine->Threads;i++)
+	{
+		engine->Workers[i].Signal = &ponder->Stop;
+	}
+	
+	atomic_store(&ponder->Stop, false);
+	atomic_store(&ponder->Done, false);
+	ponder->BestX = -1;
+	ponder->Start = GetTimeMs();
+	ponder->Running = ThreadStart(&ponder->Thread, PonderMain, engine);
+	
+	if(!ponder->Running)
+	{
+		for(i=0;i<engine->Threads;i++)
+		{
+			engine->Workers[i].Signal = NULL;
+		}
+	}
+}
+/* PonderStop()
+ *
+ *Stop the pondering, if any, and give the session back.
+*/
+void PonderStop(EngineSession *engine)
+{
+	Ponder *ponder = &engine->Ponder;
+	int i;
+	
+	if(!ponder->Running)
+	{
+		return;
+	}
+	
+	atomic_store(&ponder->Stop, true);
+	ThreadJoin(ponder->Thread);
+	ponder->Running = false;
+	
+	for(i=0;i<engine->Threads;i++)
+	{
+		engine->Workers[i].Signal = NULL;
+	}
+}
+/* PonderReply()
+ *
+ *DetermineBestMoveTimed() for the scene after the human's move, 
+ *making use of the pondering (see "Pondering").
+*/
+int PonderReply(EngineSession *engine, RoundState state, int *MoveRating, int TimeBudget, int *DepthReached)
+{
+	Ponder *ponder = &engine->Ponder;
+	int BestX, score;
+	
+	if(!ponder->Running || ponder->State.Hash != state.Hash || ponder->State.Moves != state.Moves)
+	{
+		PonderStop(engine);
+		return DetermineBestMoveTimed(engine, state, MoveRating, TimeBudget, DepthReached);
+	}
+	
+	// A hit: the search goes on until the budget is used up
+	while(!atomic_load(&ponder->Done) && GetTimeMs() < ponder->Start + TimeBudget)
+	{
+		SleepMs(PonderPoll);
+	}
+	PonderStop(engine);
+	
+	// Not even depth 1 was done
+	if(ponder->BestX == -1)
+	{
+		return DetermineBestMoveTimed(engine, state, MoveRating, TimeBudget, DepthReached);
+	}
+	
+	BestX = ponder->BestX;
+	score = ponder->Score;
+	*DepthReached = ponder->Depth;
+	
+#if VictoryTieBreak
+	if(RatingOf(score) == NeutralPosition)
+	{
+		BestX = FindMaxVP(&engine->Workers[0], &state, score, *DepthReached, BestX, 
+		                  (TimeBudget > 0)?(ponder->Start + TimeBudget):(0));
+		engine->Stats.Move = BestX;
+	}
+#endif
+	
+	*MoveRating = RatingOf(score);
+	
+	return BestX;
+}
+/* RandomMove()
+ *
+ *Pick an open column at random, from the generator 'seed' of the 
+ *caller.
+ *
+ *UPDATE: Also the dummy player of Easy mode, instead of rand().
+ *
+ *UPDATE: Returns -1 if the board is full.
+*/
+int RandomMove(const RoundState *state, uint64_t *seed)
+{
+	int x, n = 0;
+	int open[MaxX+1];
+	
+	for(x=0;x<=MaxX;x++)
+	{
+		if(state->Height[x] < ColumnHeight)
+		{
+			open[n++] = x;
+		}
+	}
+	
+	if(n == 0)
+	{
+		return -1;
+	}
+	
+	return open[SplitMix64(seed) % n];
+}
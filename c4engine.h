@@ -0,0 +1,692 @@
+#ifndef __CONNECT_4_ENGINE__
+#define __CONNECT_4_ENGINE__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#include "connect4_board.h"
+
+/* Connect 4 Engine -- The Library Behind the Game
+ *
+ *Everything that thinks about the game: the rules on the bitboards, 
+ *the searches, the Monte Carlo Tree Search and the batch kernels. 
+ *c4engine.c does no I/O at all (no printing, no input, no files), 
+ *and keeps no state of its own but read-only tables, so one program 
+ *can host any number of games at the same time:
+ * - A game is a RoundState, which belongs to the caller.
+ * - A player that thinks is an EngineSession from EngineCreate(), 
+ *   the handle of everything its searches learn and use. Sessions 
+ *   share nothing, and a session thinks about one game at a time.
+ * - Whatever is random draws from a seed of the caller (see 
+ *   SplitMix64()), so a game can be played again from its seed.
+ * - The Opening Book is a block of memory in the layout of the book 
+ *   file; the caller maps or reads it, BookAttach() only checks it.
+ *
+ *The shared tables are ZobristKey and those of the Static Evaluation. 
+ *They never change once the first EngineCreate() or GameInit() has 
+ *filled them; that first call may come from any number of threads 
+ *at once (see RunOnce()).
+ *
+ *connect4.c is the interactive game and the tools on top of it.
+*/
+//Player Flag
+typedef enum
+{
+	PLAYER_A = 1, // For User
+	PLAYER_B = 2  // For Computer
+}PLAYER;
+/* RoundState -- Basic Construction of the Game
+ *
+ *Data Members:
+ * Board    - The whole board, one bitboard per player: Board[0] 
+ *            for PLAYER_A and Board[1] for PLAYER_B. It will be 
+ *            constantly updated when the game is undergoing.
+ *
+ * Height   - Because of the rules, positions that are available 
+ *            for the next move are restricted: consider the board 
+ *            as a top-open box, the only thing you can do is grabbing 
+ *            a ball and let it free drop to the bottom. Height counts 
+ *            the balls in each column, so the next move of column x 
+ *            lands on Height[x] (counted from the bottom).
+ *
+ * CurrentPlayer - Specify which player is currently playing.
+ *
+ * Moves    - Count the moves that have been made.
+ *
+ * Hash     - Zobrist key of the board and the player to move. 
+ *            MakeMove() and RetractMove() keep it up to date, 
+ *            see "Zobrist Hashing".
+ *
+ * Eval     - Static evaluation of the board for PLAYER_A, also 
+ *            kept up to date by MakeMove() and RetractMove(), 
+ *            see "Static Evaluation".
+*/
+/* Thorough Explanation of Scene
+ *
+ *Scene is no longer stored, but it is still the way the board is 
+ *shown to users and the coordinate system of the game loops. 
+ *SceneAt() converts the bitboards back to a block of Scene.
+ *
+ *A (MaxY+1) * (MaxX+1) two-dimensional board.
+ *For each block: -1 means forbidden (in next move)
+ *                0  means available and no chess in it
+ *                1  means occupied by player A (User)
+ *                2  means occupied by player B (Computer)
+ *
+ *  0  1  2  3  4  5  6
+ * +--+--+--+--+--+--+--+
+ *0|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *1|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *2|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *3|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *4|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *5|  |  |  |  |  |  |  |
+ * +--+--+--+--+--+--+--+
+ *
+ *Initially, the bottom line should be set by 0, the other should be set by -1.
+*/
+typedef struct
+{
+	Bitboard Board[2];
+	int Height[MaxX+1];
+	PLAYER CurrentPlayer;
+	int Moves;
+	uint64_t Hash;
+	int Eval;
+}RoundState;
+/*Rating System -- Primary Evaluation
+ *
+ *Minimax Algorithm will rate moves as the 
+ *reference of the primary evaluation. More 
+ *meaningful values are WinPosition and 
+ *LosePosition.
+ *
+ *Because the algorithm evaluates on the view 
+ *of computer, WinPosition would be the best; 
+ *since NeutralPosition is relatively 
+ *meaningless, so it is set to the lowest.
+*/
+#define WinPosition     1000
+#define LosePosition    0
+#define NeutralPosition -1000
+/* Negamax Scores
+ *
+ *Inside the search, a score is always seen from the 
+ *player who is about to move: positive is good for that 
+ *player, negative is bad, and 0 means no result is found 
+ *within MaxDepth. A win is worth WinPosition minus the 
+ *number of moves played, so a quicker win (or a slower 
+ *loss) is preferred. RatingOf() translates a score back 
+ *to the Rating System above.
+ *
+ *UPDATE: With StaticEvaluation, a scene without result is 
+ *graded by the Eval of the board instead of 0, always less 
+ *than EvalLimit, so it never looks like a win.
+*/
+#define InfiniteScore (WinPosition + 1)
+#define IsWinScore(s) ((s) >= WinPosition - BoardCells)
+/* MaxDepth
+ *
+ *Depth of DetermineBestMove(). DetermineBestMoveTimed() 
+ *is limited by time instead, ThinkTime is its budget in 
+ *milliseconds for Hard mode and Hell mode.
+ *
+ *UPDATE: With StaticEvaluation, 6 moves deep already plays 
+ *better than 8 moves did with flat leaves, in half the time.
+*/
+#ifndef MaxDepth
+#define MaxDepth 6
+#endif
+#ifndef ThinkTime
+#define ThinkTime 1000
+#endif
+/* Rating System -- Secondary Evaluation
+ *
+ *It will be used only when the Primary Evaluation 
+ *NeutralPosition. The thorough explanation of 
+ *it is stated at DetermineBestMove().
+ *
+ *Counting victories needs every simulation to be played, 
+ *which the pruning of the Primary Evaluation skips. So it 
+ *is now opt-in: set VictoryTieBreak to 1 (-DVictoryTieBreak=1) 
+ *to enable it.
+ *
+ *VictoryProbability now lives in SearchContext, so that 
+ *several searches can run at the same time.
+*/
+#ifndef VictoryTieBreak
+#define VictoryTieBreak 0
+#endif
+/* Transposition Table
+ *
+ *The same scene can be reached through many different orders of 
+ *moves, so every evaluated scene is remembered here by its Hash.
+ *
+ *Data Members of an entry:
+ * Key      - The upper 32 bits of the Hash (the lower bits 
+ *            already chose the bucket).
+ * Score    - Negamax score of the scene.
+ * Depth    - How many moves were simulated below the scene.
+ * Flag     - Whether Score is exact, or only a lower or upper 
+ *            bound because of a cutoff (see EvaluateBestMove()).
+ * Age      - The Generation of the table when it was stored.
+ * BestMove - The column of the best move, -1 if unknown.
+ *
+ *Lock-free Sharing: An entry is packed into a single 64-bit word 
+ *which is read and written atomically, so any number of threads 
+ *can share one table without locks. A thread may overwrite the 
+ *entry another one just wrote, but it can never see half of an 
+ *entry: Key and data always come from the same write.
+ *
+ *  63          32 31     16 15    8 7 6 5 4 3      0
+ * +--------------+---------+-------+---+---+--------+
+ * |     Key      |  Score  | Depth |Age|Flg|BestMove|
+ * +--------------+---------+-------+---+---+--------+
+ *
+ *An all-zero word is an empty entry. Depth is at least 1 in a 
+ *stored entry, so a real entry is never all-zero.
+ *
+ *Replacement Policy: The table is split into buckets of 
+ *TTBucketSize entries. The first entry of a bucket keeps the 
+ *deepest result (it is the most expensive to rebuild), the second 
+ *one always takes the newest result.
+ *
+ *Aging: The table is kept from one move of the game to the next, 
+ *because the scenes of the next search are mostly below the 
+ *scenes of the previous one. TTNewSearch() starts a new Generation 
+ *(counting 0-3 round and round) at every search. An entry of an 
+ *older Generation is still used as it is, but to keep the first 
+ *entry of its bucket, it counts one move less deep for every 
+ *Generation it is old. The deep results near the top of a search 
+ *are soon left behind by the game, so they should not stay forever.
+ *
+ *TTMemory is the default memory budget in bytes, TTInit() can be 
+ *called with another one. A TransTable must start zeroed.
+*/
+#define TTMemory (16 * 1024 * 1024)
+#define TTBucketSize 2
+
+#define BoundExact 0
+#define BoundLower 1
+#define BoundUpper 2
+
+#define TTAgeMask 3
+
+typedef struct
+{
+	uint32_t Key;
+	int Score;
+	int Depth;
+	int Flag;
+	int Age;
+	int BestMove;
+}TTEntry;
+
+typedef struct
+{
+	atomic_uint_least64_t *Entries;
+	size_t Buckets;
+	int Generation;
+}TransTable;
+/* Threads
+ *
+ *A thin layer over Windows threads and POSIX threads. A routine 
+ *that runs in a thread is declared with ThreadRoutine(name), gets 
+ *its argument as 'arg' and ends with ThreadReturn.
+ *
+ *MaxThreads is the most threads a single search will use.
+ *
+ *A Lock is a mutex and a Condition a condition variable, for 
+ *threads that have to wait for each other, e.g. for work to do.
+ *
+ *A Once, set to OnceInit, runs a routine a single time for the whole 
+ *program, however many threads get there at the same time.
+*/
+#define MaxThreads 64
+
+#ifdef _WIN32
+typedef HANDLE ThreadHandle;
+#define ThreadRoutine(name) DWORD WINAPI name(LPVOID arg)
+#define ThreadReturn return 0
+#else
+typedef pthread_t ThreadHandle;
+#define ThreadRoutine(name) void* name(void *arg)
+#define ThreadReturn return NULL
+#endif
+
+#ifdef _WIN32
+typedef CRITICAL_SECTION Lock;
+typedef CONDITION_VARIABLE Condition;
+typedef INIT_ONCE Once;
+#define OnceInit INIT_ONCE_STATIC_INIT
+#else
+typedef pthread_mutex_t Lock;
+typedef pthread_cond_t Condition;
+typedef pthread_once_t Once;
+#define OnceInit PTHREAD_ONCE_INIT
+#endif
+/* Search Statistics
+ *
+ *Counters of a search, to see why a decision took as long as it 
+ *did. Each SearchContext counts its own, EngineBestMove() adds up 
+ *those of all workers into the Stats of its session.
+ *
+ *Data Members:
+ * Iterations     - Iterations of the Iterative Deepening that have 
+ *                  been started, the last one may be unfinished.
+ * IterationNodes - Scenes visited by each iteration (index = depth).
+ * IterationTime  - Milliseconds spent by each iteration.
+ * Nodes          - Scenes visited in total.
+ * Interior       - Scenes whose moves were simulated.
+ * Leaves         - Scenes graded without simulating: won, full, 
+ *                  or at the end of the depth.
+ * WinChecks      - Searches for a new strand by MakeMove().
+ * Cutoffs        - Cutoffs, see "Move Ordering".
+ * FirstCutoffs   - Cutoffs caused by the first move tried.
+ * TTHits         - Scenes found in the Transposition Table.
+ * TTMisses       - Scenes not found there.
+ * Time           - Milliseconds of the whole decision.
+ * FromBook       - The move came from the Opening Book.
+ * Move, Score    - The decision, and its Negamax score.
+ * Threads        - Threads that took part.
+ * TreeNodes      - Nodes of the Monte Carlo Tree Search, which 
+ *                  counts its random games as Nodes. 0 for the 
+ *                  other searches.
+ *
+ *Set SearchStatistics to 0 (-DSearchStatistics=0) and the counting 
+ *is compiled out; the counters then stay 0, except Nodes and Time.
+*/
+#ifndef SearchStatistics
+#define SearchStatistics 1
+#endif
+
+#if SearchStatistics
+#define StatAdd(ctx, field, n) ((ctx)->Stats.field += (n))
+#define StatIteration(ctx, depth, nodes, time) \
+	((ctx)->Stats.Iterations = (depth), \
+	 (ctx)->Stats.IterationNodes[depth] = (nodes), \
+	 (ctx)->Stats.IterationTime[depth] = (time))
+#else
+#define StatAdd(ctx, field, n) ((void)0)
+#define StatIteration(ctx, depth, nodes, time) ((void)sizeof(nodes), (void)sizeof(time))
+#endif
+
+typedef struct
+{
+	int Iterations;
+	long long IterationNodes[BoardCells+1];
+	long long IterationTime[BoardCells+1];
+	long long Nodes;
+	long long Interior;
+	long long Leaves;
+	long long WinChecks;
+	long long Cutoffs;
+	long long FirstCutoffs;
+	long long TTHits;
+	long long TTMisses;
+	long long Time;
+	bool FromBook;
+	int Move;
+	int Score;
+	int Threads;
+	int TreeNodes;
+}SearchStats;
+/* SearchContext -- Everything a Search Writes To
+ *
+ *Nothing but the context is changed by a search, so any number 
+ *of searches can run at the same time, each with its own context.
+ *
+ *Data Members:
+ * Table    - The Transposition Table of this search. Tables are 
+ *            lock-free, so it may be shared with other contexts.
+ *
+ * Deadline - When the search has to stop (GetTimeMs()), 
+ *            0 means no limit.
+ *
+ * Nodes    - Scenes visited by the current search.
+ *
+ * Stop     - Raised when the deadline has passed, every level 
+ *            of the recursion then returns at once and the 
+ *            result of this iteration is discarded.
+ *
+ * Signal   - Set by another thread to stop this search the same 
+ *            way as the deadline does. NULL if nobody will.
+ *
+ * Perturb  - Rotates the CenterOrder of OrderMoves(), so that 
+ *            helpers of the Lazy SMP Search walk the tree in 
+ *            different orders. 0 for the normal order.
+ *
+ * Killer, History - See "Move Ordering".
+ *
+ * PV       - The Principal Variation of an earlier search, see 
+ *            "Move Ordering". NULL if there is none.
+ *
+ * MoveStack - The moves of each level of the search, in the order 
+ *            they are simulated, indexed by the Moves of the scene.
+ *
+ * Stats    - See "Search Statistics".
+ *
+ * VictoryProbability - See "Rating System -- Secondary Evaluation".
+ *
+ *Looking at the clock is not free, so it is done once every 
+ *TimeCheckNodes scenes (a power of 2).
+*/
+#define TimeCheckNodes 1024
+
+/* PrincipalVariation
+ *
+ *The moves both players are expected to make, as a search found 
+ *them. The move of the scene after n moves is Move[n], if that 
+ *scene has the Hash Key[n]. Move[n] is -1 where nothing is known.
+*/
+typedef struct
+{
+	uint64_t Key[BoardCells+1];
+	int Move[BoardCells+1];
+}PrincipalVariation;
+
+typedef struct
+{
+	TransTable *Table;
+	long long Deadline;
+	long long Nodes;
+	bool Stop;
+	atomic_bool *Signal;
+	int Perturb;
+	int Killer[BoardCells+1][2];
+	int History[2][BoardBits];
+	const PrincipalVariation *PV;
+	int MoveStack[BoardCells+1][MaxX+1];
+	SearchStats Stats;
+	int VictoryProbability[MaxX+1];
+}SearchContext;
+/* PlayoutBatch
+ *
+ *PlayoutLanes random games played side by side, one array per 
+ *member, see "Batched Playouts" in c4engine.c.
+*/
+#define PlayoutLanes 16
+
+typedef struct
+{
+	Bitboard Mine[PlayoutLanes];
+	Bitboard Theirs[PlayoutLanes];
+	Bitboard Side[PlayoutLanes];
+	Bitboard Left[PlayoutLanes];
+	Bitboard Wins[PlayoutLanes];
+	Bitboard Ties[PlayoutLanes];
+	uint32_t Seed[PlayoutLanes];
+}PlayoutBatch;
+/* Batch Analysis
+ *
+ *AnalyzeScenes() tells, for each of many scenes, what FindWinner() 
+ *tells and what one move can change:
+ * Winner - As FindWinner().
+ * Wins   - Bit x is set if the player to move wins by column x.
+ * Blocks - Bit x is set if the opponent would win by column x, so 
+ *          the player to move has to take it first.
+ *Wins and Blocks are 0 when the game is already over.
+ *
+ *A scene is given by its two bitboards and the player to move, the 
+ *same as in RoundState but nothing else, so an array of them is 
+ *cheap to keep and to fill (e.g. from a GameArchive). The function 
+ *only reads 'scenes' and writes 'results': it has no other state, 
+ *so any number of threads may call it at the same time.
+ *
+ *Like the Batched Playouts, it works on AnalysisLanes scenes at a 
+ *time, lane by lane without branches. An empty block completes a 
+ *strand of ConnectLength when the other ConnectLength-1 blocks of 
+ *the strand are taken: for a gap at place k of the strand, k blocks 
+ *behind it along a direction and ConnectLength-1-k ahead of it. 
+ *Both are ANDs of the board shifted 1, 2... steps, each built on 
+ *the one before. As with StrandStarts(), the spare bits keep the 
+ *strands from wrapping.
+*/
+#define AnalysisLanes 16
+
+typedef struct
+{
+	Bitboard Board[2];
+	PLAYER ToMove;
+}SceneBoards;
+
+typedef struct
+{
+	int Winner;
+	uint16_t Wins;
+	uint16_t Blocks;
+}SceneAnalysis;
+/* MctsNode and MctsPool
+ *
+ *The tree of the Monte Carlo Tree Search and the pool its nodes 
+ *come from, see "Monte Carlo Tree Search" in c4engine.c.
+*/
+typedef struct
+{
+	atomic_int Visits;
+	atomic_int Wins;
+	atomic_int Child;
+	int8_t Move;
+	int8_t Count;
+}MctsNode;
+
+typedef struct
+{
+	MctsNode *Nodes;
+	int Capacity;
+	atomic_int Used;
+}MctsPool;
+/* Opening Book
+ *
+ *The first moves of every game lead to the same few scenes, so 
+ *they are searched once and for all by GenerateBook() (connect4.c) 
+ *and saved into a file. The program maps the file into memory at 
+ *startup (BookOpen()), BookAttach() checks it, and a session looks 
+ *a scene up before searching it. Nothing is parsed or copied: the 
+ *file is used as it is.
+ *
+ *File Layout (host byte order):
+ * BookHeader - Magic, the board size, the Zobrist signature 
+ *              (ZobristKey[0][0]; a book only fits the keys it 
+ *              was made with), Plies and Depth it was made with, 
+ *              and the number of Slots.
+ * BookEntry  - Slots entries, an open-addressing hash table: the 
+ *              entry of a Hash is at (Hash & (Slots - 1)), or the 
+ *              next ones if that one is taken. Slots is a power of 
+ *              2 and at least twice the number of scenes, so a 
+ *              lookup only reads one or two entries.
+ *
+ *An empty entry has Move -1. Score is the Negamax score of the 
+ *scene, and Depth the depth it was searched to.
+*/
+#define BookMagic "C4BOOK1"
+
+typedef struct
+{
+	char Magic[8];
+	uint8_t Width;
+	uint8_t Height;
+	uint8_t Plies;
+	uint8_t Depth;
+	uint32_t Reserved;
+	uint64_t Signature;
+	uint64_t Slots;
+}BookHeader;
+
+typedef struct
+{
+	uint64_t Key;
+	int16_t Score;
+	int8_t Move;
+	int8_t Depth;
+	uint32_t Reserved;
+}BookEntry;
+
+typedef struct
+{
+	const BookHeader *Header;
+	const BookEntry *Entries;
+	size_t Size;
+}OpeningBook;
+/* Ponder
+ *
+ *The pondering of a session, see "Pondering" in c4engine.c.
+*/
+typedef struct
+{
+	RoundState State;
+	bool Running;
+	ThreadHandle Thread;
+	atomic_bool Stop;
+	atomic_bool Done;
+	long long Start;
+	int BestX;
+	int Score;
+	int Depth;
+}Ponder;
+/* EngineSession -- The Handle of a Thinking Player
+ *
+ *A session keeps what the searches have learned from one move of 
+ *the game to the next:
+ * Table   - The Transposition Table, shared by all workers and 
+ *           aged at every search (see "Aging").
+ * Workers - One SearchContext per thread, with its Killer Moves 
+ *           and History (see "Move Ordering" in c4engine.c). There 
+ *           are Threads of them, allocated with the session, so a 
+ *           session of 1 thread is small enough to keep thousands.
+ * PV      - The Principal Variation of the last search.
+ * Tree    - The node pool of the Monte Carlo Tree Search, 
+ *           allocated by its first search.
+ * Ponder  - See "Pondering" in c4engine.c.
+ * Book    - The Opening Book to answer from, NULL for none. It is 
+ *           only read, so any number of sessions may share one.
+ *
+ *When the computer and then the human have moved, the new scene is 
+ *2 moves down the tree of the previous search, so much of its tree 
+ *is already there. Only EngineNewGame() forgets everything.
+ *
+ *Parallel chooses how the workers cooperate:
+ * PARALLEL_ROOT - Root-Parallel Search, the result does not depend 
+ *                 on the timing of the threads.
+ * PARALLEL_LAZY - Lazy SMP Search, it makes use of any number of cores.
+ *
+ *Stats holds the Search Statistics of the last decision.
+ *
+ *A session is big, so it is only made by EngineCreate() and given 
+ *back by EngineDestroy(). It may be used by one thread at a time, 
+ *which the workers of its searches do not count as.
+*/
+typedef enum
+{
+	PARALLEL_ROOT = 1,
+	PARALLEL_LAZY = 2
+}PARALLEL;
+
+typedef struct
+{
+	TransTable Table;
+	SearchContext *Workers;
+	int Threads;
+	PARALLEL Parallel;
+	PrincipalVariation PV;
+	SearchStats Stats;
+	MctsPool Tree;
+	Ponder Ponder;
+	const OpeningBook *Book;
+}EngineSession;
+/* Interface
+ *
+ *Each function is explained where it is defined, in c4engine.c.
+*/
+// Zobrist Hashing, filled by InitZobrist()
+extern uint64_t ZobristKey[2][BoardBits];
+extern uint64_t ZobristSide;
+
+uint64_t SplitMix64(uint64_t *seed);
+void InitZobrist();
+void InitEvaluation();
+
+// Rules
+void GameInit(RoundState *state, PLAYER player);
+PLAYER Opponent(PLAYER CurrentPlayer);
+int CalculateCoordinateY(const RoundState *state, int x);
+int SceneAt(const RoundState *state, int x, int y);
+int MakeMove(RoundState *state, int x, int y);
+void RetractMove(RoundState *state, int x, int y);
+int FindWinner(const RoundState *state);
+bool PlayMoves(RoundState *state, const char *moves);
+int RandomMove(const RoundState *state, uint64_t *seed);
+int CountChess(Bitboard b);
+
+// Time and Threads
+long long GetTimeMs();
+#ifdef _WIN32
+bool ThreadStart(ThreadHandle *thread, LPTHREAD_START_ROUTINE routine, void *param);
+#else
+bool ThreadStart(ThreadHandle *thread, void* (*routine)(void*), void *param);
+#endif
+void ThreadJoin(ThreadHandle thread);
+void ThreadDetach(ThreadHandle thread);
+void LockInit(Lock *lock);
+void LockAcquire(Lock *lock);
+void LockRelease(Lock *lock);
+void LockFree(Lock *lock);
+void ConditionInit(Condition *condition);
+void ConditionWait(Condition *condition, Lock *lock);
+void ConditionWake(Condition *condition);
+void ConditionWakeAll(Condition *condition);
+void ConditionFree(Condition *condition);
+void RunOnce(Once *once, void (*routine)(void));
+void SleepMs(int ms);
+int CountCores();
+
+// Transposition Table
+void TTInit(TransTable *table, size_t bytes);
+void TTClear(TransTable *table);
+void TTNewSearch(TransTable *table);
+bool TTProbe(TransTable *table, uint64_t key, TTEntry *entry);
+void TTStore(TransTable *table, uint64_t key, int score, int depth, int flag, int move);
+
+// Searches with a SearchContext of the caller
+void SearchContextInit(SearchContext *ctx, TransTable *table);
+void ClearMoveOrder(SearchContext *ctx);
+int EvaluateBestMove(SearchContext *ctx, RoundState *state, int *MoveRating, int depth, int alpha, int beta);
+int RatingOf(int score);
+int FindMaxVP(SearchContext *ctx, RoundState *state, int score, int depth, int BestX, long long deadline);
+int DeepenBestMove(SearchContext *ctx, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached);
+int ParallelBestMove(SearchContext workers[], int threads, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached);
+int LazyBestMove(SearchContext workers[], int threads, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached);
+
+// Engine Sessions
+EngineSession* EngineCreate(int threads, size_t memory);
+void EngineDestroy(EngineSession *engine);
+void EngineNewGame(EngineSession *engine);
+int EngineBestMove(EngineSession *engine, RoundState state, int *score, int DepthLimit, int TimeBudget, int *DepthReached);
+int DetermineBestMove(EngineSession *engine, RoundState state, int *MoveRating);
+int DetermineBestMoveTimed(EngineSession *engine, RoundState state, int *MoveRating, int TimeBudget, int *DepthReached);
+void PonderStart(EngineSession *engine, const RoundState *state);
+void PonderStop(EngineSession *engine);
+int PonderReply(EngineSession *engine, RoundState state, int *MoveRating, int TimeBudget, int *DepthReached);
+int MonteCarloBestMove(EngineSession *engine, RoundState state, int TimeBudget, int threads, long long *visits);
+
+// Batch Kernels
+void PlayoutSeed(PlayoutBatch *batch, uint64_t seed);
+void PlayoutBatchRun(PlayoutBatch *batch, Bitboard mine, Bitboard theirs, int games, int tally[3]);
+void AnalyzeScenes(const SceneBoards *scenes, SceneAnalysis *results, size_t count);
+
+// Opening Book
+bool BookAttach(OpeningBook *book, const void *data, size_t size);
+bool BookProbe(const OpeningBook *book, uint64_t key, int *move, int *score, int *depth);
+
+#endif
@@ -1,606 +1,687 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
-/* Domain of Coordinates
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#endif
+#include "c4engine.h"
+/* Connect 4 -- The Game
  *
- *Those two constants specify the 
- *maximum value that can be applied 
- *to this game.
+ *The game at the keyboard and the tools of the command line (see 
+ *main()), on top of the engine of c4engine.h. Everything that prints, 
+ *reads the keyboard or works with files is here; all the thinking 
+ *is done by c4engine.c, so both files are built together, e.g.
+ *  cc -O2 connect4.c c4engine.c -o connect4 -lm -pthread
  *
- *The domain is:
- *Any point at (0,0) to (6,5).
- *
- *The Coordinate System is shown below.
-*/
-#define MaxX 6
-#define MaxY 5
-//Player Flag
-typedef enum
-{
-	PLAYER_A = 1, // For User
-	PLAYER_B = 2  // For Computer
-}PLAYER;
-/* RoundState -- Basic Construction of the Game
- *
- *Data Members:
- * Scene    - The whole board. It will be constantly updated 
- *            when the game is undergoing.
- *
- * NextMove - Because of the rules, positions that are available 
- *            for the next move are restricted: consider the board 
- *            as a top-open box, the only thing you can do is grabbing 
- *            a ball and let it free drop to the bottom.
- *
- * CurrentPlayer - Specify which player is currently playing.
- *
- * Moves    - Count the moves that have been made.
+ *Engine is the session the computer thinks with, see StartEngine(). 
+ *GameSeed is the generator of the dummy of Easy mode, seeded by the 
+ *clock when the program starts.
 */
-/* Thorough Explanation of Scene
+EngineSession *Engine = NULL;
+uint64_t GameSeed;
+/* Screen
  *
- *A (MaxY+1) * (MaxX+1) two-dimensional board.
- *For each block: -1 means forbidden (in next move)
- *                0  means available and no chess in it
- *                1  means occupied by player A (User)
- *                2  means occupied by player B (Computer)
+ *The board is drawn into one buffer and written with a single 
+ *write, instead of a printf per block and a shell for "cls".
  *
- *  0  1  2  3  4  5  6
- * +--+--+--+--+--+--+--+
- *0|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
- *1|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
- *2|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
- *3|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
- *4|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
- *5|  |  |  |  |  |  |  |
- * +--+--+--+--+--+--+--+
+ *On a terminal, the board of a game stays at the top of the screen 
+ *(Shown) and the messages go under it. The first DisplayScene() 
+ *after ScreenClear() clears the screen and draws the whole board; 
+ *every later one moves the cursor with ANSI sequences to the blocks 
+ *that changed since the last frame (Cells) and back again. 
+ *ScreenNext() takes the place of "cls" between two moves: it clears 
+ *just the messages under the board.
  *
- *Initially, the bottom line should be set by 0, the other should be set by -1.
+ *When the output is not a terminal (a pipe or a file, see 
+ *ScreenInit()), nothing is cleared or moved, and every board is a 
+ *compact one of a character per block, '.' for nothing.
 */
+#define ScreenBoardLines (2*(MaxY+1) + 3) // Numbers, lines, blocks, numbers
+#define ScreenText       ((4*(MaxX+1) + 16) * (ScreenBoardLines + 4))
+
 typedef struct
 {
-	int Scene[MaxY+1][MaxX+1];
-	int NextMove[MaxX+1][2];
-	PLAYER CurrentPlayer;
-	int Moves;
-}RoundState;
-/*Rating System -- Primary Evaluation
+	bool Terminal;
+	bool Shown;
+	int Cells[MaxX+1][MaxY+1]; // SceneAt() of what is on the screen
+}ScreenState;
+
+ScreenState Screen;
+/* ScreenInit()
  *
- *Minimax Algorithm will rate moves as the 
- *reference of the primary evaluation. More 
- *meaningful values are WinPosition and 
- *LosePosition.
- *
- *Because the algorithm evaluates on the view 
- *of computer, WinPosition would be the best; 
- *since NeutralPosition is relatively 
- *meaningless, so it is set to the lowest.
-*/
-#define WinPosition     1000
-#define LosePosition    0
-#define NeutralPosition -1000
-/* MaxDepth
+ *Find out whether stdout is a terminal that understands ANSI 
+ *sequences; on Windows the console has to be asked to.
 */
-#define MaxDepth 8
-/* Rating System -- Secondary Evaluation
+void ScreenInit()
+{
+#ifdef _WIN32
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+	HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+	DWORD mode;
+	
+	Screen.Terminal = GetConsoleMode(console, &mode) 
+	               && SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#else
+	Screen.Terminal = isatty(STDOUT_FILENO);
+#endif
+	Screen.Shown = false;
+}
+/* ScreenWrite()
  *
- *It will be used only when the Primary Evaluation 
- *NeutralPosition. The thorough explanation of 
- *it is stated at DetermineBestMove().
+ *Write 'length' characters of 'text' to stdout at once, after 
+ *whatever printf() has left in the buffer of stdout.
 */
-int VictoryProbability[MaxX+1] = {0};
-/* CalculateCoordinateY()
+void ScreenWrite(const char *text, size_t length)
+{
+	fflush(stdout);
+#ifdef _WIN32
+	fwrite(text, 1, length, stdout);
+	fflush(stdout);
+#else
+	while(length > 0)
+	{
+		ssize_t written = write(STDOUT_FILENO, text, length);
+		
+		if(written <= 0)
+		{
+			break;
+		}
+		text += written;
+		length -= written;
+	}
+#endif
+}
+/* ScreenClear()
  *
- *This function is a helper function of DetermineBestMove().
+ *Start over with an empty screen.
+*/
+void ScreenClear()
+{
+	Screen.Shown = false;
+	
+	if(Screen.Terminal)
+	{
+		ScreenWrite("\x1b[H\x1b[2J", 7);
+	}
+	else
+	{
+		ScreenWrite("\n", 1);
+	}
+}
+/* ScreenNext()
  *
- *DetermineBestMove() only returns the x-coordinate of next 
- *move. So CalculateCoordinateY() can scan NextMove Matrix 
- *to find the y-coordinate. Because in each turn, the 
- *x-coordinate of next move is unique.
+ *Clear the messages under the board, or the whole screen if there 
+ *is no board.
 */
-int CalculateCoordinateY(RoundState state, int x)
+void ScreenNext()
 {
-	int i;
+	char text[32];
+	int length;
 	
-	for(i=0;i<=MaxX;i++)
+	if(!Screen.Terminal || !Screen.Shown)
 	{
-		if(state.NextMove[i][0] == x)
-		{
-			return state.NextMove[i][1];
-		}
+		ScreenClear();
+		return;
 	}
 	
-	return -1;
+	length = snprintf(text, sizeof(text), "\x1b[%d;1H\x1b[J", ScreenBoardLines + 2);
+	ScreenWrite(text, length);
 }
 /* DisplayScene()
  *
  *Display the board on the screen.
+ *
+ *UPDATE: Drawn as told in "Screen", a frame in one write.
+ *
+ *UPDATE: The state is only read, so it is not copied.
 */
-void DisplayScene(RoundState state)
+void DisplayScene(const RoundState *state)
 {
+	char text[ScreenText];
+	size_t n = 0;
 	int i,j;
 	int k,code;
 	
+	if(!Screen.Terminal)
+	{
+		n += snprintf(text + n, sizeof(text) - n, "  ");
+		for(k=0;k<=MaxX;k++)
+		{
+			n += snprintf(text + n, sizeof(text) - n, "%d", k);
+		}
+		for(i=0;i<=MaxY;i++)
+		{
+			n += snprintf(text + n, sizeof(text) - n, "\n%d ", i);
+			for(j=0;j<=MaxX;j++)
+			{
+				code = SceneAt(state, j, i);
+				text[n++] = (code == -1)?('.'):('0' + code);
+			}
+		}
+		n += snprintf(text + n, sizeof(text) - n, "\n\n");
+		
+		ScreenWrite(text, n);
+		return;
+	}
+	
+	if(Screen.Shown)
+	{
+		// Save the cursor, redraw the blocks that changed, restore it
+		n += snprintf(text + n, sizeof(text) - n, "\x1b" "7");
+		for(i=0;i<=MaxY;i++)
+		{
+			for(j=0;j<=MaxX;j++)
+			{
+				code = SceneAt(state, j, i);
+				if(code != Screen.Cells[j][i])
+				{
+					n += snprintf(text + n, sizeof(text) - n, "\x1b[%d;%dH%c", 
+					              2*i + 3, 4*j + 4, (code == -1)?(' '):('0' + code));
+					Screen.Cells[j][i] = code;
+				}
+			}
+		}
+		n += snprintf(text + n, sizeof(text) - n, "\x1b" "8");
+		
+		ScreenWrite(text, n);
+		return;
+	}
+	
+	n += snprintf(text + n, sizeof(text) - n, "\x1b[H\x1b[2J");
+	
 	for(k=0;k<=MaxX;k++)
 	{
-		printf("   %d",k);
+		n += snprintf(text + n, sizeof(text) - n, "   %d", k);
 	}
 	
-	printf("\n");
+	n += snprintf(text + n, sizeof(text) - n, "\n");
 	
 	for(i=0;i<=MaxY;i++)
 	{
-		printf(" ");
+		n += snprintf(text + n, sizeof(text) - n, " ");
 		for(k=0;k<=MaxX;k++)
 		{
-			printf("+---");
+			n += snprintf(text + n, sizeof(text) - n, "+---");
 		}
-		printf("+\n");
-		printf("%d",i);
+		n += snprintf(text + n, sizeof(text) - n, "+\n%d", i);
 		
 		for(j=0;j<=MaxX;j++)
 		{
-			code = state.Scene[i][j];
+			code = SceneAt(state, j, i);
+			Screen.Cells[j][i] = code;
 			
 			if(code == -1)
 			{
-				printf("|   ");
+				n += snprintf(text + n, sizeof(text) - n, "|   ");
 			}
 			else
 			{
-				printf("| %d ", state.Scene[i][j]);
+				n += snprintf(text + n, sizeof(text) - n, "| %d ", code);
 			}
 		}
-		printf("|\n");
+		n += snprintf(text + n, sizeof(text) - n, "|\n");
 	}
 	
-	printf(" ");
+	n += snprintf(text + n, sizeof(text) - n, " ");
 	for(k=0;k<=MaxX;k++)
 	{
-		printf("+---");
+		n += snprintf(text + n, sizeof(text) - n, "+---");
 	}
-	printf("+\n");
+	n += snprintf(text + n, sizeof(text) - n, "+\n");
 	for(k=0;k<=MaxX;k++)
 	{
-		printf("   %d",k);
+		n += snprintf(text + n, sizeof(text) - n, "   %d", k);
 	}
 	
-	printf("\n\n");
+	n += snprintf(text + n, sizeof(text) - n, "\n\n");
+	
+	Screen.Shown = true;
+	ScreenWrite(text, n);
 }
-/* Direction Matrix
+/* CheckNextStep()
  *
- *Used by FindWinner().
+ *UPDATE: For the consideration of efficiency, this function now 
+ *only works for users in the main loop.
+*/
+bool CheckNextStep(const RoundState *state, int x, int y)
+{
+	if(y == -1)
+		return false;
+	
+	return CalculateCoordinateY(state, x) == y;
+}
+/* StatsLog
  *
- *Each coordinate represents a direction vector. The whole matrix 
- *states 8 directions relative to a center point.
+ *Where the Search Statistics of every decision go, one line of 
+ *JSON each, NULL for nowhere. "--stats" sets it to stderr.
 */
-const int Direction[8][2] = {{0,-1},{1,-1},{1,0},{1,1},{0,1},{-1,1},{-1,0},{-1,-1}};
-/* GameInit()
+FILE *StatsLog = NULL;
+/* FormatStats()
+ *
+ *Write 'stats' of a decision in the scene 'state' as one line of JSON, 
+ *without the newline, into 'text' of 'size' characters. StatsText 
+ *is enough for any decision. Returns the length of the line.
  *
- *Preparations before the game starts.
+ *UPDATE: The decision is kept in 'stats'. A decision of the Monte 
+ *Carlo Tree Search has a line of its own kind.
 */
-void GameInit(RoundState *state, PLAYER player)
+#define StatsText 4096
+
+int FormatStats(char *text, size_t size, const SearchStats *stats, const RoundState *state)
 {
-	int i,j;
+	size_t length;
+	int i;
 	
-	// Initialize Scene Matrix
-	for(i=0;i<=MaxY;i++)
-	{
-		for(j=0;j<=MaxX;j++)
-		{
-			state->Scene[i][j] = -1;
-		}
-	}
-	// Modify the bottom line
-	for(j=0;j<=MaxX;j++)
+	if(stats->TreeNodes > 0)
 	{
-		state->Scene[MaxY][j] = 0;
+		return snprintf(text, size, "{\"moves\":%d,\"move\":%d,\"mcts\":true,\"time_ms\":%lld,\"visits\":%lld,"
+		                "\"visits_per_sec\":%lld,\"tree_nodes\":%d,\"threads\":%d}", 
+		                state->Moves, stats->Move, stats->Time, stats->Nodes, 
+		                (stats->Time > 0)?(stats->Nodes * 1000 / stats->Time):(0), stats->TreeNodes, stats->Threads);
 	}
 	
-	// Initialize NextMove Matrix
-	for(i=0;i<=MaxX;i++)
+	length = snprintf(text, size, "{\"moves\":%d,\"move\":%d,\"score\":%d,\"book\":%s,\"time_ms\":%lld,\"nodes\":%lld,"
+	                  "\"interior\":%lld,\"leaves\":%lld,\"win_checks\":%lld,\"cutoffs\":%lld,"
+	                  "\"first_cutoff_ratio\":%.3f,\"tt_hits\":%lld,\"tt_misses\":%lld,\"iterations\":[", 
+	                  state->Moves, stats->Move, stats->Score, (stats->FromBook)?("true"):("false"), stats->Time, stats->Nodes, 
+	                  stats->Interior, stats->Leaves, stats->WinChecks, stats->Cutoffs, 
+	                  (stats->Cutoffs > 0)?((double)stats->FirstCutoffs / stats->Cutoffs):(0.0), 
+	                  stats->TTHits, stats->TTMisses);
+	
+	for(i=1;i<=stats->Iterations && length < size;i++)
 	{
-		state->NextMove[i][0] = i;
-		state->NextMove[i][1] = MaxY;
+		length += snprintf(text + length, size - length, "%s{\"depth\":%d,\"nodes\":%lld,\"time_ms\":%lld}", 
+		                   (i > 1)?(","):(""), i, stats->IterationNodes[i], stats->IterationTime[i]);
 	}
 	
-	state->CurrentPlayer = player;
-	
-	// Reset the global counter
-	state->Moves = 0;
-	
-	// Initialize VictoryProbability Matrix
-	for(i=0;i<=MaxX;i++)
+	if(length < size)
 	{
-		VictoryProbability[i] = 0;
+		length += snprintf(text + length, size - length, "]}");
 	}
 	
-	// Initialize the seed
-	srand((unsigned int)time(NULL));
+	return (int)length;
+}
+/* PrintStats()
+ *
+ *FormatStats() as a line of 'file'.
+*/
+void PrintStats(FILE *file, const SearchStats *stats, const RoundState *state)
+{
+	char text[StatsText];
+	
+	FormatStats(text, sizeof(text), stats, state);
+	fprintf(file, "%s\n", text);
+	fflush(file);
 }
-/* Opponent()
+/* LogStats()
  *
- *UPDATE: Find the opponent of the player who is currently playing.
+ *PrintStats() of the last decision of Engine into StatsLog, if it 
+ *is set.
 */
-PLAYER Opponent(PLAYER CurrentPlayer)
+void LogStats(const RoundState *state)
 {
-	switch(CurrentPlayer)
+	if(StatsLog != NULL)
 	{
-		case PLAYER_A:
-			return PLAYER_B;
-			
-		case PLAYER_B:
-			return PLAYER_A;
+		PrintStats(StatsLog, &Engine->Stats, state);
 	}
 }
-/* CheckNextStep()
+/* MapFile()
  *
- *UPDATE: For the consideration of efficiency, this function now 
- *only works for users in the main loop.
+ *Map the whole file 'path' into memory, read only. Returns NULL 
+ *if it cannot be opened or is empty, otherwise *size is its size. 
+ *Give it back with UnmapFile().
 */
-bool CheckNextStep(RoundState state, int x, int y)
+const void* MapFile(const char *path, size_t *size)
 {
-	int i = 0;
-	
-	if(y == -1)
-		return false;
+	void *data = NULL;
+#ifdef _WIN32
+	HANDLE file, mapping;
+	LARGE_INTEGER length;
 	
-	for(i=0;i<=MaxX;i++)
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+	{
+		return NULL;
+	}
+	if(GetFileSizeEx(file, &length) && length.QuadPart > 0)
 	{
-		if(state.NextMove[i][0] == -1)
+		*size = (size_t)length.QuadPart;
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mapping != NULL)
 		{
-			continue;
+			data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
 		}
-		else if(state.NextMove[i][0] == x && state.NextMove[i][1] == y)
+	}
+	CloseHandle(file);
+#else
+	int fd;
+	struct stat info;
+	
+	fd = open(path, O_RDONLY);
+	if(fd < 0)
+	{
+		return NULL;
+	}
+	if(fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		*size = (size_t)info.st_size;
+		data = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+		if(data == MAP_FAILED)
 		{
-			return true;
+			data = NULL;
 		}
 	}
+	close(fd);
+#endif
 	
-	return false;
+	return data;
 }
-/* MakeMove()
- *Old SetNewChess()
+/* UnmapFile()
  *
- *UPDATE: In order to consider the effeciency, MakeMove() 
- *will no longer check if the coordinate is in the correct range.
+ *Give back a mapping of MapFile().
 */
-void MakeMove(RoundState *state, int x, int y)
+void UnmapFile(const void *data, size_t size)
 {
-	// Mark that position
-	state->Scene[y][x] = state->CurrentPlayer;
-	
-	// Update the NextMove Matrix
-	if(y > 0)
-	{
-		state->Scene[y-1][x] = 0;
-		state->NextMove[x][0] = x;
-		state->NextMove[x][1] = y-1;
-	}
-	// If we reach the top, disable this column
-	else if(y == 0)
-	{
-		state->NextMove[x][0] = -1;
-		state->NextMove[x][1] = -1;
-	}
-	
-	// Reverse the player
-	state->CurrentPlayer = Opponent(state->CurrentPlayer);
-	
-	// Finish this turn
-	state->Moves++;
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+#else
+	munmap((void*)data, size);
+#endif
 }
-/* RetractMove()
+#define BookFile "connect4.book"
+
+OpeningBook EngineBook;
+/* BookOpen()
  *
- *UPDATE: Retract one move, actually does the same job as MakeMove().
+ *Map the book file 'path' into memory. Returns false, and leaves 
+ *the book empty, if there is no such file or it does not fit 
+ *this program.
  *
- *UPDATE: In order to consider the effeciency, RetractMove() 
- *will also not check if the coordinate is in the correct range. 
- *So if it will be used by users, adding a function CheckRetraction() 
- *is necessary to make sure if this position is the top number(1 or 2) 
- *of this column.
+ *UPDATE: The book is checked by BookAttach() of the engine.
 */
-void RetractMove(RoundState *state, int x, int y)
+bool BookOpen(OpeningBook *book, const char *path)
 {
-	// Reset this position
-	state->Scene[y][x] = 0;
-	// If there is any meaningless zero, reset it
-	if(y > 0)
+	size_t size;
+	const void *data = MapFile(path, &size);
+	
+	if(data == NULL)
 	{
-		state->Scene[y-1][x] = -1;
+		return false;
 	}
 	
-	// Update the NextMove Matrix
-	// We do not need to check the y-coordinate now, 
-	//because you cannot make a move outside anyway.
-	state->NextMove[x][0] = x;
-	state->NextMove[x][1] = y;
-	
-	// Reverse the player
-	state->CurrentPlayer = Opponent(state->CurrentPlayer);
+	if(!BookAttach(book, data, size))
+	{
+		UnmapFile(data, size);
+		return false;
+	}
 	
-	// Roll back this turn
-	state->Moves--;
+	return true;
 }
-/* FindWinner()
+/* StartEngine()
  *
- *UPDATE: new update of CheckWinner(), it is faster.
+ *(Re)make Engine with 'threads' workers, or one per core if threads 
+ *is 0. It answers from EngineBook if the book is open. Returns false 
+ *if there is not enough memory.
 */
-int FindWinner(RoundState state)
+bool StartEngine(int threads)
 {
-	int x,y,m,n;
-	int NextX,NextY;
-	int id;
-	bool pass;
+	EngineDestroy(Engine);
 	
-	if(state.Moves < 7)
+	Engine = EngineCreate(threads, 0);
+	if(Engine == NULL)
 	{
-		return -1;
+		printf("Not enough memory.\n");
+		return false;
 	}
 	
-	for(x=0;x<=MaxX;x++)
+	if(EngineBook.Header != NULL)
 	{
-		for(y=MaxY;y>=0;y--)
-		{
-			id = state.Scene[y][x];
-			
-			if(id == 0 || id == -1)
-			{
-				//Instead of 'continue', we search the Scene vertically, 
-				//based on the rule, it would be meaningless if we linear 
-				//search a winner strand based on a reference of 0 or -1.
-				//Surprisingly, the values above 0 would always be -1.
-				break;
-			}
-			
-			for(m=0;m<8;m++) // Direction
-			{
-				pass = true;
-				NextX = x;
-				NextY = y;
-				
-				for(n=0;n<3;n++) // Number of points scanned forward
-				{
-					NextX += Direction[m][0];
-					NextY += Direction[m][1];
-					
-					if((NextX<0 || NextX>MaxX) || (NextY<0 || NextY>MaxY))
-					{
-						//This strand is a dead strand, so it is not 
-						//necessary to step forward along this direction.
-						pass = false;
-						break;
-					}
-					
-					if(state.Scene[NextY][NextX] != id)
-					{
-						//This strand is a dead strand, so it is not 
-						//necessary to step forward along this direction.
-						pass = false;
-						break;
-					}
-				}
-				
-				if(pass) // All three points are passed
-				{
-					// Winner strand is detected, no need to continue on.
-					return id;
-				}
-			}
-		}
+		Engine->Book = &EngineBook;
 	}
 	
-	return -1;
+	return true;
 }
-/* Minimax Algorithm
+/* Game Records
  *
- *DetermineBestMove() and EvaluatePosition()
+ *Every game can be archived into a compact binary file. A file is 
+ *just a stream of frames, one per game, and new games are appended 
+ *at the end, so it never has to be rewritten.
  *
- *The core is a recursion involved two functions. These 2 functions 
- *call each other to evaluate 'current' Scene.
+ *Frame Layout (bytes):
+ * 0     RecordSync, where every frame starts.
+ * 1     Width (high 4 bits) and Height (low 4 bits) of the board.
+ * 2     ConnectLength (low 4 bits), who started (bit 4 set for 
+ *       PLAYER_B) and the result (bits 5-6, see below).
+ * 3     n, the number of moves.
+ * 4...  The columns of the n moves, 4 bits each and 2 per byte, 
+ *       the earlier move in the low half.
+ * last  XOR of all bytes before it, so that a damaged frame (e.g. 
+ *       the program stopped while writing it) is recognised and 
+ *       skipped. The reader then looks for the next RecordSync.
  *
- *DetermineBestMove() will simulate what the Scene would look like 
- *next step as many as possible. How many scenario it can evaluate 
- *depends on the 'depth' value. Bsed on the experimental data, when 
- *depth = 10, it is goning to take more than a minute to think.
+ *A full game on the 7 * 6 board takes 26 bytes.
  *
- *Since it is a game, the winning and losing scenes might occur at 
- *any round, instead after all blocks are filled. So the number of 
- *all possiblities would be extremely hard to determine accurately.
+ *GameRecorder writes the games of the game loops as they are 
+ *played, GameArchive reads a file mapped into memory: a GameRecord 
+ *points right into the file, nothing is copied.
 */
-int EvaluatePosition(RoundState, int);
-/* EvaluateBestMove()
- *
- *Entry point of the evaluation.
- *
- *Find a best move among those simulated scenes. how many final-round 
- *situations can be simulated depends on depth value.
+#define GameFile   "connect4.games"
+#define RecordSync 0xC4
+#define RecordSize (4 + (BoardCells+1)/2 + 1) // At most
+
+#if MaxX+1 > 15 || MaxY+1 > 15
+#error "Game Records need a board of at most 15 * 15."
+#endif
+
+#define ResultNone 0 // Not finished
+#define ResultA    PLAYER_A
+#define ResultB    PLAYER_B
+#define ResultDraw 3
+
+typedef struct
+{
+	FILE *File;
+	PLAYER First;
+	int Moves;
+	uint8_t Columns[BoardCells];
+}GameRecorder;
+
+typedef struct
+{
+	int Width;
+	int Height;
+	int Connect;
+	PLAYER First;
+	int Result;
+	int Moves;
+	const uint8_t *Packed;
+}GameRecord;
+
+typedef struct
+{
+	const uint8_t *Data;
+	size_t Size;
+	size_t Offset;
+}GameArchive;
+
+// Column of move i of a GameRecord
+#define RecordColumn(record, i) (((record)->Packed[(i)/2] >> (((i) & 1)*4)) & 0x0F)
+
+GameRecorder GameLog;
+/* ResultOf()
  *
- *The concept is easy: EvaluateBestMove(), assisted with EvaluatePosition(), 
- *continuously plays(simulates) this game. When a result occurs(win/lose/draw), 
- *EvaluateBestMove() will catch a rating of this simulation, if the rating is 
- *benefit for computer/not benefit for user, and better than previous one, this 
- *simulation(move) will be reserved.
+ *The result of the game in 'state', as it is recorded.
 */
-int EvaluateBestMove(RoundState state, int *MoveRating, int depth)
+int ResultOf(const RoundState *state)
 {
-	int i;
-	int Move[2], BestMoveX;
-	int MaxRating = NeutralPosition - 1; // in order to be replaced at the first time
-	int Rating;
-	
-	for(i=0; i<=MaxX; i++)
-	{
-		if(state.NextMove[i][0] == -1)
-		{
-			continue;
-		}
-		
-		Move[0] = state.NextMove[i][0];
-		Move[1] = state.NextMove[i][1];
-		
-		// Tactical Prediction Stage
-		
-		// Virtually make a move
-		MakeMove(&state, Move[0], Move[1]);
-		
-		// Evaluate this move
-		Rating = EvaluatePosition(state, depth + 1);
-		
-		// Secondary Rating Mechanism
-		if(Rating == WinPosition)
-		{
-			VictoryProbability[i]++;
-		}
-		
-		// Primary Rating Mechanism
-		if (Rating > MaxRating)
-		{
-			BestMoveX = Move[0];
-			MaxRating = Rating;
-        }
-        
-		// Retract this move, that is why we call it 'virtual'
-		RetractMove(&state, Move[0], Move[1]);
-	}
+	int winner = FindWinner(state);
 	
-	// Rating of the CURRENT Move
-	//This is tricky: Each simulated step is actually made by different 
-	//players. Since the rating is used for computer (PLAYER_B), so a 
-	//good move for PLAYER_B is a bad move for PLAYER_A. Therefore when 
-	//the recursion is rolling back, we need to reverse the evaluation 
-	//result if the current player is switched to PLAYER_A.
-	//Which means that this algorithm is actually evaluating for both sides, 
-	//but only the best move for computer (PLAYER_B) should be preserved and 
-	//the rest should be eliminated properly.
-	*MoveRating = (state.CurrentPlayer == PLAYER_B)?(MaxRating):(-MaxRating);
-	
-	/*
-	if(*MoveRating == NeutralPosition)
+	if(winner != -1)
 	{
-		BestMoveX = FindMaxVP();
+		return winner;
 	}
-	*/
 	
-	//For this game only, we do not need to return a coordinate. 
-	//Because at each turn, the x-coordinate is unique in NextMove, 
-	//y-coordinate, however, is not.
-	return BestMoveX;
+	return (state->Moves == BoardCells)?(ResultDraw):(ResultNone);
 }
-/* EvaluatePosition()
+/* EncodeRecord()
  *
- *This function is easier to understand: check if the simulation is 
- *over(hence the game is over). If so, grade this simulation; if not, 
- *come back to DetermineBestMove() to proceed the current simulation.
+ *Write the frame of a game into 'frame' (RecordSize bytes at 
+ *most). Returns the length of the frame.
 */
-int EvaluatePosition(RoundState state, int depth)
+int EncodeRecord(uint8_t *frame, PLAYER first, const uint8_t *columns, int moves, int result)
 {
-	int rate;
-	int code = FindWinner(state);
+	int i, length = 4 + (moves+1)/2;
+	uint8_t check = 0;
+	
+	frame[0] = RecordSync;
+	frame[1] = (uint8_t)(((MaxX+1) << 4) | (MaxY+1));
+	frame[2] = (uint8_t)(ConnectLength | ((first == PLAYER_B) << 4) | (result << 5));
+	frame[3] = (uint8_t)moves;
 	
-	if(code != -1 || depth >= MaxDepth)
+	memset(frame + 4, 0, (moves+1)/2);
+	for(i=0;i<moves;i++)
 	{
-		//PossibleScenes++;
-		
-		if(code == PLAYER_B)
-		{
-			return WinPosition;
-		}
-		else if(code == PLAYER_A)
-		{
-			return LosePosition;
-		}
-		else
-		{
-			return NeutralPosition;
-		}
+		frame[4 + i/2] |= (uint8_t)(columns[i] << ((i & 1)*4));
 	}
 	
-	// Game is undergoing, proceed the simulation
-	EvaluateBestMove(state, &rate, depth);
-	return rate;
+	for(i=0;i<length;i++)
+	{
+		check ^= frame[i];
+	}
+	frame[length] = check;
+	
+	return length + 1;
 }
-/* DetermineBestMove()
- *
- *It is an external packer function to make a final 
- *decision through considering ratings from primary 
- *and secondary rating system.
+/* RecorderOpen()
  *
- *The concept is: because of the limitation of depth 
- *value, many scenes might not reveal a result. This 
- *time the primary evaluation will always return 
- *NeutralPosition. Then we need the secondary evaluation. 
- *
- *VictoryProbability stores the total number of scenes of 
- *WinPosition for each point where you can make the move.
- *A higher number stands for a higher chance you are going 
- *to win finally.
+ *Append the games of 'recorder' to the file 'path'. Returns false, 
+ *and records nothing, if the file cannot be opened.
 */
-int DetermineBestMove(RoundState state, int *MoveRating)
+bool RecorderOpen(GameRecorder *recorder, const char *path)
 {
-	int BestX;
-	int i, max = -1;
-	
-	BestX = EvaluateBestMove(state, MoveRating, 0);
+	recorder->File = fopen(path, "ab");
+	recorder->Moves = 0;
 	
-	if(*MoveRating == NeutralPosition)
+	return recorder->File != NULL;
+}
+/* RecordStart(), RecordMove() and RecordFinish()
+ *
+ *Start a game right after GameInit(), add each move after it has 
+ *been made, and write the frame when the game is over. They do 
+ *nothing if the recorder is not open.
+*/
+void RecordStart(GameRecorder *recorder, const RoundState *state)
+{
+	recorder->First = state->CurrentPlayer;
+	recorder->Moves = 0;
+}
+
+void RecordMove(GameRecorder *recorder, int x)
+{
+	if(recorder->Moves < BoardCells)
 	{
-		// Find the maximum probability
-		for(i=0;i<=MaxX;i++)
-		{
-			if(VictoryProbability[i] > max)
-			{
-				max = VictoryProbability[i];
-				BestX = i;
-			}
-		}
+		recorder->Columns[recorder->Moves++] = (uint8_t)x;
 	}
+}
+
+void RecordFinish(GameRecorder *recorder, const RoundState *state)
+{
+	uint8_t frame[RecordSize];
+	int length;
 	
-	// Clean up VictoryProbability for the next round.
-	for(i=0;i<=MaxX;i++)
+	if(recorder->File == NULL)
 	{
-		VictoryProbability[i] = 0;
+		return;
 	}
 	
-	return BestX;
+	length = EncodeRecord(frame, recorder->First, recorder->Columns, recorder->Moves, ResultOf(state));
+	fwrite(frame, 1, length, recorder->File);
+	fflush(recorder->File);
 }
-/* RandCreate()
+/* ArchiveOpen()
  *
- *Create a random number within the domain [low, high).
+ *Map the record file 'path' for ArchiveNext(). Returns false if 
+ *there is no such file, or it is empty.
 */
-int RandCreate(int low, int high) 
+bool ArchiveOpen(GameArchive *archive, const char *path)
 {
-	int val;
-	val = ((int)(rand()%(high - low)) + low);
-	return(val);
+	archive->Data = (const uint8_t*)MapFile(path, &archive->Size);
+	archive->Offset = 0;
+	
+	return archive->Data != NULL;
 }
-/* DummyPlayer()
- *
- *A dummy procedure to play against players.
+/* ArchiveNext()
  *
- *Dummy player uses a randomly picked coordinate to make a move.
+ *Read the next game into 'record'. Damaged frames are skipped. 
+ *Returns false at the end of the file.
 */
-int DummyPlayer(RoundState *state)
+bool ArchiveNext(GameArchive *archive, GameRecord *record)
 {
-	int choice;
+	const uint8_t *frame;
+	size_t length, i;
+	uint8_t check;
 	
-	while(1)
+	while(archive->Offset + 5 <= archive->Size)
 	{
-		// Why MaxX+1? See comments of RandCreate() and RoundState
-		choice = RandCreate(0, MaxX+1);
-		if(state->NextMove[choice][0] != -1)
+		frame = archive->Data + archive->Offset;
+		length = 4 + (frame[3]+1)/2;
+		
+		if(frame[0] == RecordSync && archive->Offset + length < archive->Size 
+		   && frame[3] <= (frame[1] >> 4) * (frame[1] & 0x0F))
 		{
-			break;
+			check = 0;
+			for(i=0;i<length;i++)
+			{
+				check ^= frame[i];
+			}
+			
+			if(check == frame[length])
+			{
+				record->Width = frame[1] >> 4;
+				record->Height = frame[1] & 0x0F;
+				record->Connect = frame[2] & 0x0F;
+				record->First = (frame[2] & 0x10)?(PLAYER_B):(PLAYER_A);
+				record->Result = (frame[2] >> 5) & 0x03;
+				record->Moves = frame[3];
+				record->Packed = frame + 4;
+				
+				archive->Offset += length + 1;
+				return true;
+			}
 		}
+		
+		// Not a frame, look for the next one
+		archive->Offset++;
 	}
 	
-	return choice;
-	
-	//MakeMove(state, state->NextMove[choice][0], state->NextMove[choice][1]);
+	return false;
+}
+/* ArchiveClose()
+ *
+ *Give back the mapping of ArchiveOpen().
+*/
+void ArchiveClose(GameArchive *archive)
+{
+	if(archive->Data != NULL)
+	{
+		UnmapFile(archive->Data, archive->Size);
+		archive->Data = NULL;
+	}
 }
 const char* Instruction1 = 
 "\nWelcome to Connect 4\n\n"
@@ -642,7 +723,7 @@ void WaitForSpace(char* hint)
 		
 		if(ch == ' ')
 		{
-			system("cls");
+			ScreenClear();
 			break;
 		}
 	}
@@ -696,8 +777,8 @@ void DemoHelper(RoundState *game)
 	{
 		printf("Your move: ");
 		scanf("%d",&x);
-		y = CalculateCoordinateY(*game, x);
-		if(CheckNextStep(*game, x, y))
+		y = CalculateCoordinateY(game, x);
+		if(CheckNextStep(game, x, y))
 		{
 			break;
 		}
@@ -713,31 +794,31 @@ void DemoHelper(RoundState *game)
 */
 void EnterInstruction(RoundState *game)
 {
-	system("cls");
+	ScreenClear();
 	
-	printf(Instruction1, MaxY+1, MaxX+1);
+	DisplayScene(game);
 	
-	DisplayScene(*game);
+	printf(Instruction1, MaxY+1, MaxX+1);
 	
 	WaitForSpace("\n\nPress SPACE to proceed.");
 	
-	printf(Instruction2, MaxX);
+	DisplayScene(game);
 	
-	DisplayScene(*game);
+	printf(Instruction2, MaxX);
 	
 	// Hack the move counter, because FindWinner() works only after the 7th move.
 	game->Moves = 7;
 	
 	DemoHelper(game);
 	
-	printf(Instruction3);
+	DisplayScene(game);
 	
-	DisplayScene(*game);
+	printf(Instruction3);
 	
-	while(FindWinner(*game) == -1)
+	while(FindWinner(game) == -1)
 	{
 		DemoHelper(game);
-		DisplayScene(*game);
+		DisplayScene(game);
 	}
 	
 	printf(Instruction4);
@@ -761,6 +842,10 @@ void EnterInstruction(RoundState *game)
  *
  *2-player mode
  *	2 users play the game.
+ *
+ *Monte Carlo mode
+ *	Computer makes a move after thousands of random games, 
+ *as long as the Hard Mode thinks (see "Monte Carlo Tree Search").
 */
 int ModeHelper()
 {
@@ -771,7 +856,8 @@ int ModeHelper()
 	       "2 -> Hard mode\n"
 	       "3 -> Hell mode\n"
 	       "4 -> 2-player mode\n"
-	       "Enter your choice(1|2|3|4):");
+	       "5 -> Monte Carlo mode\n"
+	       "Enter your choice(1|2|3|4|5):");
 	
 	while(1)
 	{
@@ -790,6 +876,9 @@ int ModeHelper()
 				
 			case '4':
 				return 4;
+				
+			case '5':
+				return 5;
 			
 			default:
 				break;
@@ -805,7 +894,7 @@ void Guidance()
 	RoundState game;
 	bool bRules;
 	
-	system("cls");
+	ScreenClear();
 	
 	printf("Welcome to Connect 4\n\n");
 	
@@ -823,11 +912,11 @@ void Guidance()
 */
 void GameMain_EasyMode(RoundState *state)
 {
-	int x,y,rating;
+	int x,y = -1;
 	
-	DisplayScene(*state);
+	DisplayScene(state);
 	
-	while((FindWinner(*state) == -1) && (state->Moves <= (MaxX+1)*(MaxY+1)))
+	while((FindWinner(state) == -1) && (state->Moves < BoardCells))
 	{
 		switch(state->CurrentPlayer)
 		{
@@ -838,30 +927,37 @@ void GameMain_EasyMode(RoundState *state)
 					printf("Your move: ");
 					//scanf("%d %d",&x,&y);
 					scanf("%d",&x);
-					y = CalculateCoordinateY(*state, x);
-					if(CheckNextStep(*state, x, y))
+					y = CalculateCoordinateY(state, x);
+					if(CheckNextStep(state, x, y))
 					{
 						break;
 					}
 					printf("Illegal Input, try again.\n");
 				}
-				system("cls");
+				ScreenNext();
 				break;
 			}
 			
 			case PLAYER_B:
 			{
-				x = DummyPlayer(state);
-				y = CalculateCoordinateY(*state, x);
-				system("cls");
+				x = RandomMove(state, &GameSeed);
+				y = CalculateCoordinateY(state, x);
+				ScreenNext();
 				printf("Computer makes a move (%d,%d).\n",x,y);
 				break;
 			}
 		}
 		
+		// No open column for the computer, a draw
+		if(x < 0)
+		{
+			break;
+		}
+		
 		MakeMove(state, x, y);
+		RecordMove(&GameLog, x);
 		
-		DisplayScene(*state);
+		DisplayScene(state);
 	}
 	
 	return;
@@ -869,97 +965,125 @@ void GameMain_EasyMode(RoundState *state)
 /* GameMain_HardMode()
  *
  *The game loop for Hard Mode.
+ *
+ *UPDATE: The computer ponders while the human thinks.
 */
 void GameMain_HardMode(RoundState *state)
 {
-	int x,y,rating;
+	int x,y = -1,rating,depth;
 	
-	DisplayScene(*state);
+	DisplayScene(state);
 	
-	while((FindWinner(*state) == -1) && (state->Moves <= (MaxX+1)*(MaxY+1)))
+	while((FindWinner(state) == -1) && (state->Moves < BoardCells))
 	{
 		switch(state->CurrentPlayer)
 		{
 			case PLAYER_A:
 			{
+				PonderStart(Engine, state);
 				while(1)
 				{
 					printf("Your move: ");
 					//scanf("%d %d",&x,&y);
 					scanf("%d",&x);
-					y = CalculateCoordinateY(*state, x);
-					if(CheckNextStep(*state, x, y))
+					y = CalculateCoordinateY(state, x);
+					if(CheckNextStep(state, x, y))
 					{
 						break;
 					}
 					printf("Illegal Input, try again.\n");
 				}
-				system("cls");
+				ScreenNext();
 				break;
 			}
 			
 			case PLAYER_B:
 				printf("Computer is thinking...");
-				x = DetermineBestMove(*state, &rating);
-				y = CalculateCoordinateY(*state, x);
-				system("cls");
-				printf("\nIt makes the move (%d, %d) (%d)\n",x,y,rating);
+				x = PonderReply(Engine, *state, &rating, ThinkTime, &depth);
+				LogStats(state);
+				y = CalculateCoordinateY(state, x);
+				ScreenNext();
+				printf("\nIt makes the move (%d, %d) (%d, depth %d)\n",x,y,rating,depth);
 				break;
 		}
 		
+		// No open column for the computer, a draw
+		if(x < 0)
+		{
+			break;
+		}
+		
 		MakeMove(state, x, y);
+		RecordMove(&GameLog, x);
 		
-		DisplayScene(*state);
+		DisplayScene(state);
 	}
 	
+	// The human may have ended the game
+	PonderStop(Engine);
+	
 	return;
 }
 /* GameMain_HellMode()
  *
  *The game loop for Hell Mode.
+ *
+ *UPDATE: The computer ponders while the human thinks.
 */
 void GameMain_HellMode(RoundState *state)
 {
-	int x,y,rating;
+	int x,y = -1,rating,depth;
 	
-	//DisplayScene(*state);
+	//DisplayScene(state);
 	
-	while((FindWinner(*state) == -1) && (state->Moves <= (MaxX+1)*(MaxY+1)))
+	while((FindWinner(state) == -1) && (state->Moves < BoardCells))
 	{
 		switch(state->CurrentPlayer)
 		{
 			case PLAYER_A:
 			{
+				PonderStart(Engine, state);
 				while(1)
 				{
 					printf("Your move: ");
 					//scanf("%d %d",&x,&y);
 					scanf("%d",&x);
-					y = CalculateCoordinateY(*state, x);
-					if(CheckNextStep(*state, x, y))
+					y = CalculateCoordinateY(state, x);
+					if(CheckNextStep(state, x, y))
 					{
 						break;
 					}
 					printf("Illegal Input, try again.\n");
 				}
-				//system("cls");
+				//ScreenNext();
 				break;
 			}
 			
 			case PLAYER_B:
 				printf("Computer is thinking...");
-				x = DetermineBestMove(*state, &rating);
-				y = CalculateCoordinateY(*state, x);
-				//system("cls");
-				printf("\nIt makes the move (%d, %d) (%d)\n",x,y,rating);
+				x = PonderReply(Engine, *state, &rating, ThinkTime, &depth);
+				LogStats(state);
+				y = CalculateCoordinateY(state, x);
+				//ScreenNext();
+				printf("\nIt makes the move (%d, %d) (%d, depth %d)\n",x,y,rating,depth);
 				break;
 		}
 		
+		// No open column for the computer, a draw
+		if(x < 0)
+		{
+			break;
+		}
+		
 		MakeMove(state, x, y);
+		RecordMove(&GameLog, x);
 		
-		//DisplayScene(*state);
+		//DisplayScene(state);
 	}
 	
+	// The human may have ended the game
+	PonderStop(Engine);
+	
 	return;
 }
 /* GameMain_TwoPlayerMode()
@@ -968,67 +1092,2054 @@ void GameMain_HellMode(RoundState *state)
 */
 void GameMain_TwoPlayerMode(RoundState *state)
 {
-	int x,y,rating;
+	int x,y;
 	
-	DisplayScene(*state);
+	DisplayScene(state);
 	
-	while((FindWinner(*state) == -1) && (state->Moves <= (MaxX+1)*(MaxY+1)))
+	while((FindWinner(state) == -1) && (state->Moves < BoardCells))
 	{
 		printf("%s makes a move: ", state->CurrentPlayer==PLAYER_A?"Player A":"Player B");
 		
 		while(1)
 		{
 			scanf("%d",&x);
-			y = CalculateCoordinateY(*state, x);
-			if(CheckNextStep(*state, x, y))
+			y = CalculateCoordinateY(state, x);
+			if(CheckNextStep(state, x, y))
 			{
 				break;
 			}
 			printf("Illegal Input, try again.\n");
 		}
 		
-		system("cls");
-		printf("%s makes a move (%d,%d).",
+		ScreenNext();
+		printf("%s makes a move (%d,%d).\n",
 		       state->CurrentPlayer==PLAYER_A?"Player A":"Player B",
 			   x,y);
 		
 		MakeMove(state, x, y);
+		RecordMove(&GameLog, x);
 		
-		DisplayScene(*state);
+		DisplayScene(state);
 	}
 	
 	return;
 }
-/* main()
+/* GameMain_MonteCarloMode()
  *
- *The entry point of the game.
+ *The game loop for Monte Carlo Mode.
 */
-int main()
+void GameMain_MonteCarloMode(RoundState *state)
 {
-	RoundState game;
-	int choice;
-	
-	Guidance();
+	int x,y = -1;
+	long long visits;
 	
-	// The main loop of the game.
+	DisplayScene(state);
 	
-	while(true)
+	while((FindWinner(state) == -1) && (state->Moves < BoardCells))
 	{
-		choice = ModeHelper();
-		GameInit(&game, PLAYER_B);
-		
-		printf("\n\n");
-		
-		switch(choice)
+		switch(state->CurrentPlayer)
 		{
-			case 1:
-				GameMain_EasyMode(&game);
-				break;
-				
-			case 2:
-				GameMain_HardMode(&game);
-				break;
-				
+			case PLAYER_A:
+			{
+				while(1)
+				{
+					printf("Your move: ");
+					scanf("%d",&x);
+					y = CalculateCoordinateY(state, x);
+					if(CheckNextStep(state, x, y))
+					{
+						break;
+					}
+					printf("Illegal Input, try again.\n");
+				}
+				ScreenNext();
+				break;
+			}
+			
+			case PLAYER_B:
+				printf("Computer is thinking...");
+				x = MonteCarloBestMove(Engine, *state, ThinkTime, Engine->Threads, &visits);
+				LogStats(state);
+				y = CalculateCoordinateY(state, x);
+				ScreenNext();
+				printf("\nIt makes the move (%d, %d) (%lld visits, %lld visits/s)\n",x,y,visits,
+				       (Engine->Stats.Time > 0)?(visits * 1000 / Engine->Stats.Time):(0));
+				break;
+		}
+		
+		// No open column for the computer, a draw
+		if(x < 0)
+		{
+			break;
+		}
+		
+		MakeMove(state, x, y);
+		RecordMove(&GameLog, x);
+		
+		DisplayScene(state);
+	}
+	
+	return;
+}
+/* SmpBenchmark()
+ *
+ *Scaling of the Lazy SMP Search: search every scene of SmpScenes 
+ *to SmpDepth with 1, 2, 4, 8 and 16 threads, starting with an empty 
+ *table each time, and report the speedup against 1 thread.
+*/
+#define SmpDepth 16
+
+const char* SmpScenes[] = {"", "3", "33", "3324", "332415"};
+
+int SmpBenchmark()
+{
+	const int threads[] = {1, 2, 4, 8, 16};
+	RoundState state;
+	long long start, elapsed, base = 0, nodes;
+	int i, n, t, score, depth;
+	
+	printf("Lazy SMP scaling, depth %d, %d scenes, %d cores\n\n", 
+	       SmpDepth, (int)(sizeof(SmpScenes)/sizeof(SmpScenes[0])), CountCores());
+	printf("threads   time(ms)        nodes  speedup\n");
+	
+	for(i=0;i<(int)(sizeof(threads)/sizeof(threads[0]));i++)
+	{
+		if(!StartEngine(threads[i]))
+		{
+			return 1;
+		}
+		elapsed = 0;
+		nodes = 0;
+		
+		for(n=0;n<(int)(sizeof(SmpScenes)/sizeof(SmpScenes[0]));n++)
+		{
+			GameInit(&state, PLAYER_B);
+			PlayMoves(&state, SmpScenes[n]);
+			EngineNewGame(Engine);
+			
+			start = GetTimeMs();
+			EngineBestMove(Engine, state, &score, SmpDepth, 0, &depth);
+			elapsed += GetTimeMs() - start;
+			
+			for(t=0;t<threads[i];t++)
+			{
+				nodes += Engine->Workers[t].Nodes;
+			}
+		}
+		
+		if(i == 0)
+		{
+			base = elapsed;
+		}
+		
+		printf("%7d %10lld %12lld %8.2f\n", threads[i], elapsed, nodes, 
+		       (elapsed > 0)?((double)base / elapsed):(0.0));
+	}
+	
+	return 0;
+}
+/* MctsBenchmark()
+ *
+ *Speed of the Monte Carlo Tree Search: think about every scene of 
+ *SmpScenes for MctsBenchTime milliseconds with 1, 2, 4, 8 and 16 
+ *threads, and report the visits per second.
+*/
+#define MctsBenchTime 1000
+
+int MctsBenchmark()
+{
+	const int threads[] = {1, 2, 4, 8, 16};
+	RoundState state;
+	long long visits, total, base = 0;
+	int i, n, count = (int)(sizeof(SmpScenes)/sizeof(SmpScenes[0]));
+	
+	if(!StartEngine(1))
+	{
+		return 1;
+	}
+	
+	printf("Monte Carlo Tree Search, %d ms per scene, %d scenes, %d cores\n\n", 
+	       MctsBenchTime, count, CountCores());
+	printf("threads       visits   visits/s  speedup\n");
+	
+	for(i=0;i<(int)(sizeof(threads)/sizeof(threads[0]));i++)
+	{
+		total = 0;
+		
+		for(n=0;n<count;n++)
+		{
+			GameInit(&state, PLAYER_B);
+			PlayMoves(&state, SmpScenes[n]);
+			
+			MonteCarloBestMove(Engine, state, MctsBenchTime, threads[i], &visits);
+			LogStats(&state);
+			total += visits;
+		}
+		
+		if(i == 0)
+		{
+			base = total;
+		}
+		
+		printf("%7d %12lld %10lld %8.2f\n", threads[i], total, total * 1000 / ((long long)MctsBenchTime * count), 
+		       (base > 0)?((double)total / base):(0.0));
+	}
+	
+	return 0;
+}
+/* PlayoutBenchmark()
+ *
+ *Speed of the Batched Playouts on one core: 'games' random games 
+ *from the empty board. Their results are also a check of the 
+ *kernel: the one who starts wins about 56% of random games on the 
+ *7 * 6 board.
+*/
+#define PlayoutBenchGames 4000000
+
+int PlayoutBenchmark(int games)
+{
+	PlayoutBatch batch;
+	long long start, elapsed;
+	int tally[3];
+	
+	if(games <= 0)
+	{
+		games = PlayoutBenchGames;
+	}
+	
+	PlayoutSeed(&batch, 1);
+	
+	start = GetTimeMs();
+	PlayoutBatchRun(&batch, 0, 0, games, tally);
+	elapsed = GetTimeMs() - start;
+	
+	printf("%d random games, %d lanes, %lld ms, %lld games/s\n", games, PlayoutLanes, elapsed, 
+	       (elapsed > 0)?((long long)games * 1000 / elapsed):(0));
+	printf("First player: %.2f%% wins, %.2f%% ties, %.2f%% losses\n", 
+	       100.0 * tally[2] / games, 100.0 * tally[1] / games, 100.0 * tally[0] / games);
+	
+	return 0;
+}
+/* Benchmark
+ *
+ *A fixed suite of scenes, each searched to its own depth by one 
+ *worker with an empty table and without the Opening Book, so every 
+ *run does exactly the same work. Besides the speed (nodes per 
+ *second), each scene reports a checksum of its Hash, best move, 
+ *score and nodes: a different checksum means the search behaves 
+ *differently, not only faster or slower.
+ *
+ *Change BenchVersion whenever BenchSuite is changed, so that only 
+ *results of the same suite are compared.
+*/
+#define BenchVersion 1
+
+typedef struct
+{
+	const char *Moves;
+	int Depth;
+}BenchScene;
+
+const BenchScene BenchSuite[] = 
+{
+	{"",         14},
+	{"3",        14},
+	{"33",       14},
+	{"3324",     14},
+	{"3332",     14},
+	{"0123456",  14},
+	{"0352065",  14},
+	{"33333222", 14},
+	{"32066114", 14},
+	{"3243323",  16},
+	{"10152511", 16},
+	{"252555",   16}
+};
+/* BenchMix()
+ *
+ *Mix 'value' into the checksum 'check'.
+*/
+uint64_t BenchMix(uint64_t check, uint64_t value)
+{
+	uint64_t seed = check ^ value;
+	
+	return SplitMix64(&seed);
+}
+/* Benchmark()
+ *
+ *Run BenchSuite, see "Benchmark".
+*/
+int Benchmark()
+{
+	RoundState state;
+	long long start, elapsed, TotalTime = 0, TotalNodes = 0;
+	uint64_t check, suite = BenchVersion;
+	int i, x, score, depth;
+	int count = (int)(sizeof(BenchSuite)/sizeof(BenchSuite[0]));
+	
+	if(!StartEngine(1))
+	{
+		return 1;
+	}
+	
+	printf("Benchmark suite %d, %d scenes, 1 thread\n\n", BenchVersion, count);
+	printf("  # moves     depth move score        nodes   time(ms)        nps  checksum\n");
+	
+	for(i=0;i<count;i++)
+	{
+		GameInit(&state, PLAYER_B);
+		if(!PlayMoves(&state, BenchSuite[i].Moves))
+		{
+			printf("Scene %d is illegal.\n", i + 1);
+			return 1;
+		}
+		EngineNewGame(Engine);
+		
+		start = GetTimeMs();
+		x = EngineBestMove(Engine, state, &score, BenchSuite[i].Depth, 0, &depth);
+		elapsed = GetTimeMs() - start;
+		
+		check = BenchMix(state.Hash, (uint64_t)x);
+		check = BenchMix(check, (uint64_t)(int64_t)score);
+		check = BenchMix(check, (uint64_t)Engine->Workers[0].Nodes);
+		suite = BenchMix(suite, check);
+		
+		TotalTime += elapsed;
+		TotalNodes += Engine->Workers[0].Nodes;
+		
+		LogStats(&state);
+		
+		printf("%3d %-9s %5d %4d %5d %12lld %10lld %10lld  %08lx\n", i + 1, 
+		       (BenchSuite[i].Moves[0] != '\0')?(BenchSuite[i].Moves):("-"), 
+		       depth, x, score, (long long)Engine->Workers[0].Nodes, elapsed, 
+		       (elapsed > 0)?(Engine->Workers[0].Nodes * 1000 / elapsed):(0), 
+		       (unsigned long)(check & 0xFFFFFFFF));
+	}
+	
+	printf("\nTotal: %lld nodes, %lld ms, %lld nps, checksum %08lx\n", TotalNodes, TotalTime, 
+	       (TotalTime > 0)?(TotalNodes * 1000 / TotalTime):(0), (unsigned long)(suite & 0xFFFFFFFF));
+	
+	return 0;
+}
+/* Self-Play
+ *
+ *Games without anybody at the keyboard, played by one worker per 
+ *core. Each worker has its own SearchContext and a small table of 
+ *SelfPlayMemory, cleared before every game, and the engine searches 
+ *a fixed depth, so a game depends on nothing but its number.
+ *
+ *Against the engine itself, the first SelfPlayOpening moves are 
+ *random and each side rotates its move order (Perturb) at random, 
+ *so that the games do not repeat. Against the dummy, the engine is 
+ *PLAYER_B and the dummy PLAYER_A, picking any open column by 
+ *RandomMove(). Who starts alternates from game to game.
+ *
+ *Every game is appended to the record file as a frame of "Game 
+ *Records".
+*/
+#define SelfPlayFile    "selfplay.games"
+#define SelfPlayGames   10000
+#define SelfPlayDepth   4
+#define SelfPlayOpening 4
+#define SelfPlayMemory  (1024 * 1024)
+
+typedef struct
+{
+	int Games;
+	int Depth;
+	bool Dummy;
+	FILE *Record;
+	atomic_int Next;
+	atomic_int Wins[3]; // Draws, PLAYER_A, PLAYER_B
+	atomic_int FirstWins;
+}SelfPlayJob;
+
+typedef struct
+{
+	SelfPlayJob *Job;
+	SearchContext Context;
+	TransTable Table;
+}SelfPlayWorker;
+/* SelfPlayMain()
+ *
+ *What a worker does: play games until enough have been started.
+*/
+ThreadRoutine(SelfPlayMain)
+{
+	SelfPlayWorker *worker = (SelfPlayWorker*)arg;
+	SelfPlayJob *job = worker->Job;
+	SearchContext *ctx = &worker->Context;
+	RoundState state;
+	uint64_t seed;
+	uint8_t columns[BoardCells], frame[RecordSize];
+	int n, x, code, score, depth, length, perturb[2];
+	PLAYER first;
+	
+	while((n = atomic_fetch_add(&job->Next, 1)) < job->Games)
+	{
+		seed = (uint64_t)n;
+		first = (n % 2 == 0)?(PLAYER_A):(PLAYER_B);
+		perturb[0] = (job->Dummy)?(0):((int)(SplitMix64(&seed) % (MaxX+1)));
+		perturb[1] = (job->Dummy)?(0):((int)(SplitMix64(&seed) % (MaxX+1)));
+		
+		GameInit(&state, first);
+		TTClear(&worker->Table);
+		ClearMoveOrder(ctx);
+		code = -1;
+		
+		while(code == -1 && state.Moves < BoardCells)
+		{
+			if(job->Dummy)
+			{
+				x = (state.CurrentPlayer == PLAYER_A)?(RandomMove(&state, &seed)):(-1);
+			}
+			else
+			{
+				x = (state.Moves < SelfPlayOpening)?(RandomMove(&state, &seed)):(-1);
+			}
+			
+			if(x == -1)
+			{
+				ctx->Perturb = perturb[state.CurrentPlayer-1];
+				TTNewSearch(&worker->Table);
+				x = DeepenBestMove(ctx, state, &score, job->Depth, 0, &depth);
+			}
+			
+			columns[state.Moves] = (uint8_t)x;
+			code = MakeMove(&state, x, 0);
+		}
+		
+		// One call per frame, so the frames of the workers never mix
+		if(job->Record != NULL)
+		{
+			length = EncodeRecord(frame, first, columns, state.Moves, (code == -1)?(ResultDraw):(code));
+			fwrite(frame, 1, length, job->Record);
+		}
+		
+		atomic_fetch_add(&job->Wins[(code == -1)?(0):(code)], 1);
+		if(code == (int)first)
+		{
+			atomic_fetch_add(&job->FirstWins, 1);
+		}
+	}
+	
+	ThreadReturn;
+}
+/* SelfPlay()
+ *
+ *Play 'games' games of the engine (searching 'depth' moves) against 
+ *itself, or against the dummy if 'dummy' is set, on all cores. The 
+ *records go to 'path' (none if NULL). Returns 0 on success.
+*/
+int SelfPlay(int games, int depth, bool dummy, const char *path)
+{
+	SelfPlayJob job;
+	SelfPlayWorker *worker;
+	ThreadHandle thread[MaxThreads];
+	bool started[MaxThreads];
+	int threads = CountCores(), i;
+	long long start, elapsed;
+	
+	if(threads > MaxThreads)
+	{
+		threads = MaxThreads;
+	}
+	
+	job.Games = games;
+	job.Depth = depth;
+	job.Dummy = dummy;
+	job.Record = NULL;
+	atomic_init(&job.Next, 0);
+	atomic_init(&job.FirstWins, 0);
+	for(i=0;i<3;i++)
+	{
+		atomic_init(&job.Wins[i], 0);
+	}
+	
+	if(path != NULL)
+	{
+		job.Record = fopen(path, "wb");
+		if(job.Record == NULL)
+		{
+			printf("Cannot write %s.\n", path);
+			return 1;
+		}
+	}
+	
+	worker = (SelfPlayWorker*)calloc(threads, sizeof(SelfPlayWorker));
+	if(worker == NULL)
+	{
+		printf("Not enough memory.\n");
+		return 1;
+	}
+	
+	printf("Self-play: %d games, engine (depth %d) vs %s, %d threads\n", 
+	       games, depth, (dummy)?("dummy"):("engine"), threads);
+	
+	start = GetTimeMs();
+	
+	for(i=0;i<threads;i++)
+	{
+		worker[i].Job = &job;
+		TTInit(&worker[i].Table, SelfPlayMemory);
+		SearchContextInit(&worker[i].Context, &worker[i].Table);
+	}
+	for(i=1;i<threads;i++)
+	{
+		started[i] = ThreadStart(&thread[i], SelfPlayMain, &worker[i]);
+	}
+	SelfPlayMain(&worker[0]);
+	for(i=1;i<threads;i++)
+	{
+		if(started[i])
+		{
+			ThreadJoin(thread[i]);
+		}
+	}
+	
+	elapsed = GetTimeMs() - start;
+	
+	if(job.Record != NULL)
+	{
+		fclose(job.Record);
+	}
+	
+	if(dummy)
+	{
+		printf("Engine:       %d wins, %d draws, %d losses\n", 
+		       atomic_load(&job.Wins[PLAYER_B]), atomic_load(&job.Wins[0]), atomic_load(&job.Wins[PLAYER_A]));
+	}
+	else
+	{
+		printf("First player: %d wins, %d draws, %d losses\n", atomic_load(&job.FirstWins), 
+		       atomic_load(&job.Wins[0]), games - atomic_load(&job.Wins[0]) - atomic_load(&job.FirstWins));
+	}
+	printf("%d games in %.2f s, %.1f games/sec\n", games, elapsed / 1000.0, 
+	       (elapsed > 0)?(games * 1000.0 / elapsed):(0.0));
+	
+	for(i=0;i<threads;i++)
+	{
+		free(worker[i].Table.Entries);
+	}
+	free(worker);
+	
+	return 0;
+}
+/* Record Checking
+ *
+ *While ScanRecords() reads the games, every scene of a game played 
+ *on this board is kept, with the column played from it, in a 
+ *ScanBatch. A full batch goes through AnalyzeScenes() at once, and 
+ *each move is checked against the result: a winning move that was 
+ *not taken is a missed win; with no win at hand, an open win of the 
+ *opponent that was not taken is a missed block.
+*/
+#define ScanScenes 4096
+
+typedef struct
+{
+	SceneBoards Scenes[ScanScenes];
+	SceneAnalysis Results[ScanScenes];
+	int8_t Played[ScanScenes];
+	int Count;
+	long long Total;
+	long long MissedWins;
+	long long MissedBlocks;
+}ScanBatch;
+/* ScanCheck()
+ *
+ *Analyse the scenes kept in 'batch', see "Record Checking".
+*/
+void ScanCheck(ScanBatch *batch)
+{
+	int i;
+	
+	AnalyzeScenes(batch->Scenes, batch->Results, (size_t)batch->Count);
+	
+	for(i=0;i<batch->Count;i++)
+	{
+		if(batch->Results[i].Wins != 0)
+		{
+			if(((batch->Results[i].Wins >> batch->Played[i]) & 1) == 0)
+			{
+				batch->MissedWins++;
+			}
+		}
+		else if(batch->Results[i].Blocks != 0 && ((batch->Results[i].Blocks >> batch->Played[i]) & 1) == 0)
+		{
+			batch->MissedBlocks++;
+		}
+	}
+	
+	batch->Total += batch->Count;
+	batch->Count = 0;
+}
+/* ScanRecords()
+ *
+ *Read every game of the record file 'path' and report what is in 
+ *it, and how fast it can be scanned.
+ *
+ *UPDATE: The games played on this board are replayed and checked 
+ *for missed wins and blocks, see "Record Checking".
+*/
+int ScanRecords(const char *path)
+{
+	GameArchive archive;
+	GameRecord record;
+	ScanBatch *batch;
+	Bitboard board[2];
+	PLAYER player;
+	long long games = 0, moves = 0, results[4] = {0}, FirstWins = 0, others = 0;
+	long long start, elapsed;
+	int i, column, sum = 0;
+	int height[MaxX+1];
+	
+	if(!ArchiveOpen(&archive, path))
+	{
+		printf("Cannot read %s.\n", path);
+		return 1;
+	}
+	
+	batch = (ScanBatch*)calloc(1, sizeof(ScanBatch));
+	if(batch == NULL)
+	{
+		printf("Not enough memory.\n");
+		ArchiveClose(&archive);
+		return 1;
+	}
+	
+	start = GetTimeMs();
+	
+	while(ArchiveNext(&archive, &record))
+	{
+		games++;
+		moves += record.Moves;
+		results[record.Result]++;
+		if(record.Result == (int)record.First)
+		{
+			FirstWins++;
+		}
+		
+		if(record.Width != MaxX+1 || record.Height != ColumnHeight || record.Connect != ConnectLength)
+		{
+			others++;
+			for(i=0;i<record.Moves;i++)
+			{
+				sum += RecordColumn(&record, i);
+			}
+			continue;
+		}
+		
+		board[0] = 0;
+		board[1] = 0;
+		memset(height, 0, sizeof(height));
+		player = record.First;
+		for(i=0;i<record.Moves;i++)
+		{
+			column = RecordColumn(&record, i);
+			sum += column;
+			if(column > MaxX || height[column] == ColumnHeight)
+			{
+				break;
+			}
+			
+			batch->Scenes[batch->Count].Board[0] = board[0];
+			batch->Scenes[batch->Count].Board[1] = board[1];
+			batch->Scenes[batch->Count].ToMove = player;
+			batch->Played[batch->Count] = (int8_t)column;
+			if(++batch->Count == ScanScenes)
+			{
+				ScanCheck(batch);
+			}
+			
+			board[player-1] |= BottomBit(column) << height[column];
+			height[column]++;
+			player = Opponent(player);
+		}
+	}
+	if(batch->Count > 0)
+	{
+		ScanCheck(batch);
+	}
+	
+	elapsed = GetTimeMs() - start;
+	
+	printf("%s: %lld games in %lu bytes (%.1f bytes per game), %.1f moves per game\n", path, games, 
+	       (unsigned long)archive.Size, (games > 0)?((double)archive.Size / games):(0.0), 
+	       (games > 0)?((double)moves / games):(0.0));
+	printf("PLAYER_A %lld, PLAYER_B %lld, draws %lld, unfinished %lld, first player won %lld\n", 
+	       results[ResultA], results[ResultB], results[ResultDraw], results[ResultNone], FirstWins);
+	printf("Scanned in %lld ms (column checksum %d)\n", elapsed, sum);
+	printf("%lld scenes checked: %lld wins missed, %lld blocks missed (%lld games of other boards)\n", 
+	       batch->Total, batch->MissedWins, batch->MissedBlocks, others);
+	
+	free(batch);
+	ArchiveClose(&archive);
+	return 0;
+}
+/* Book Generation
+ *
+ *GenerateBook() collects every scene up to 'plies' moves from the 
+ *empty board, with either player starting, searches each of them 
+ *'depth' moves deep with Engine, and writes the book.
+ *
+ *Scenes are collected into a BookEntry table laid out exactly like 
+ *the file, so the same table is filled by the search and then 
+ *written as it is. Until a scene is searched, its entry has Move 0 
+ *and Reserved is the index of the scene in Scenes.
+*/
+#define BookPlies 6
+#define BookDepth 16
+
+typedef struct
+{
+	BookEntry *Entries;
+	RoundState *Scenes;
+	uint64_t Slots;
+	uint64_t Count;
+}BookBuilder;
+/* BookFind()
+ *
+ *The entry of Hash 'key' in the table, or the empty entry where 
+ *it belongs.
+*/
+BookEntry* BookFind(BookEntry *entries, uint64_t slots, uint64_t key)
+{
+	uint64_t i;
+	
+	for(i = key & (slots - 1); entries[i].Move != -1; i = (i + 1) & (slots - 1))
+	{
+		if(entries[i].Key == key)
+		{
+			break;
+		}
+	}
+	
+	return &entries[i];
+}
+/* BookAdd()
+ *
+ *Add a scene to the builder, doubling the table when it is half 
+ *full. Returns false if the scene is already there or there is 
+ *no memory left.
+*/
+bool BookAdd(BookBuilder *builder, const RoundState *state)
+{
+	BookEntry *entry, *entries;
+	RoundState *scenes;
+	uint64_t i;
+	
+	if(2 * (builder->Count + 1) > builder->Slots)
+	{
+		entries = (BookEntry*)malloc(2 * builder->Slots * sizeof(BookEntry));
+		scenes = (RoundState*)realloc(builder->Scenes, builder->Slots * sizeof(RoundState));
+		if(entries == NULL || scenes == NULL)
+		{
+			free(entries);
+			if(scenes != NULL)
+			{
+				builder->Scenes = scenes;
+			}
+			return false;
+		}
+		
+		memset(entries, 0xFF, 2 * builder->Slots * sizeof(BookEntry));
+		for(i=0;i<builder->Slots;i++)
+		{
+			if(builder->Entries[i].Move != -1)
+			{
+				*BookFind(entries, 2 * builder->Slots, builder->Entries[i].Key) = builder->Entries[i];
+			}
+		}
+		
+		free(builder->Entries);
+		builder->Entries = entries;
+		builder->Scenes = scenes;
+		builder->Slots *= 2;
+	}
+	
+	entry = BookFind(builder->Entries, builder->Slots, state->Hash);
+	if(entry->Move != -1)
+	{
+		// Reached before through another order of moves
+		return false;
+	}
+	
+	entry->Key = state->Hash;
+	entry->Move = 0;
+	entry->Reserved = (uint32_t)builder->Count;
+	builder->Scenes[builder->Count++] = *state;
+	
+	return true;
+}
+/* CollectScenes()
+ *
+ *Add the scene and all scenes below it, down to 'plies' moves 
+ *from the empty board. Scenes that are over are skipped.
+*/
+void CollectScenes(BookBuilder *builder, RoundState *state, int plies)
+{
+	int x;
+	
+	if(!BookAdd(builder, state) || state->Moves >= plies)
+	{
+		return;
+	}
+	
+	for(x=0;x<=MaxX;x++)
+	{
+		if(state->Height[x] == ColumnHeight)
+		{
+			continue;
+		}
+		
+		if(MakeMove(state, x, 0) == -1 && state->Moves < BoardCells)
+		{
+			CollectScenes(builder, state, plies);
+		}
+		RetractMove(state, x, 0);
+	}
+}
+/* GenerateBook()
+ *
+ *See "Book Generation". Returns 0 on success.
+*/
+int GenerateBook(const char *path, int plies, int depth)
+{
+	BookBuilder builder;
+	BookHeader header;
+	RoundState state;
+	FILE *file;
+	uint64_t i, done = 0;
+	int score, reached;
+	long long start = GetTimeMs();
+	
+	builder.Slots = 1024;
+	builder.Count = 0;
+	builder.Entries = (BookEntry*)malloc(builder.Slots * sizeof(BookEntry));
+	builder.Scenes = (RoundState*)malloc(builder.Slots / 2 * sizeof(RoundState));
+	
+	if(builder.Entries == NULL || builder.Scenes == NULL)
+	{
+		printf("Not enough memory.\n");
+		free(builder.Entries);
+		free(builder.Scenes);
+		return 1;
+	}
+	
+	memset(builder.Entries, 0xFF, builder.Slots * sizeof(BookEntry));
+	
+	GameInit(&state, PLAYER_A);
+	CollectScenes(&builder, &state, plies);
+	GameInit(&state, PLAYER_B);
+	CollectScenes(&builder, &state, plies);
+	
+	printf("%llu scenes up to %d plies, searching %d deep...\n", 
+	       (unsigned long long)builder.Count, plies, depth);
+	
+	if(!StartEngine(0))
+	{
+		free(builder.Entries);
+		free(builder.Scenes);
+		return 1;
+	}
+	EngineNewGame(Engine);
+	
+	for(i=0;i<builder.Slots;i++)
+	{
+		if(builder.Entries[i].Move == -1)
+		{
+			continue;
+		}
+		
+		state = builder.Scenes[builder.Entries[i].Reserved];
+		
+		builder.Entries[i].Move = (int8_t)EngineBestMove(Engine, state, &score, depth, 0, &reached);
+		builder.Entries[i].Score = (int16_t)score;
+		builder.Entries[i].Depth = (int8_t)reached;
+		builder.Entries[i].Reserved = 0;
+		
+		if(++done % 1000 == 0)
+		{
+			printf("%llu / %llu\n", (unsigned long long)done, (unsigned long long)builder.Count);
+		}
+	}
+	
+	memset(&header, 0, sizeof(header));
+	memcpy(header.Magic, BookMagic, sizeof(BookMagic));
+	header.Width = MaxX+1;
+	header.Height = MaxY+1;
+	header.Plies = (uint8_t)plies;
+	header.Depth = (uint8_t)depth;
+	header.Signature = ZobristKey[0][0];
+	header.Slots = builder.Slots;
+	
+	file = fopen(path, "wb");
+	if(file == NULL 
+	   || fwrite(&header, sizeof(header), 1, file) != 1 
+	   || fwrite(builder.Entries, sizeof(BookEntry), builder.Slots, file) != builder.Slots)
+	{
+		printf("Cannot write %s.\n", path);
+		if(file != NULL)
+		{
+			fclose(file);
+		}
+		free(builder.Entries);
+		free(builder.Scenes);
+		return 1;
+	}
+	fclose(file);
+	
+	printf("%s: %llu scenes in %lld ms.\n", path, (unsigned long long)builder.Count, GetTimeMs() - start);
+	
+	free(builder.Entries);
+	free(builder.Scenes);
+	return 0;
+}
+/* Solved Table
+ *
+ *The Arduino version (connect4.h) plays on a 6 * 4 board, which is 
+ *small enough to be solved completely here. GenerateSolvedTable() 
+ *solves it and writes a C source file, which puts the table into 
+ *the flash memory (PROGMEM) of the Arduino. There, SolvedBestMove() 
+ *(connect4_solved.c) finds the perfect move without any search.
+ *
+ *Build it for that board first: -DMaxX=5 -DMaxY=3.
+ *
+ *Only the scenes the computer (PLAYER_B) can really face are kept: 
+ *those reached when the computer plays the moves of the table and 
+ *the user plays anything, whoever starts. Neither are the scenes 
+ *where ForcedMove() already knows the answer, because the Arduino 
+ *checks it before the table.
+ *
+ *Each scene is saved as its Key: the chess of PLAYER_B plus all 
+ *chess plus BottomRow. Adding BottomRow sets the block above the 
+ *top chess of each column, so the Key tells every scene apart, and 
+ *it fits 32 bits on this board. Keys are sorted for a binary search, 
+ *and the moves are packed 2 per byte in the same order.
+ *
+ *A fully solved table is about 650 KB. An Arduino Uno has 32 KB of 
+ *flash, so by default the table stops at SolvedPlies moves (about 
+ *12 KB), and the Arduino searches the few moves left after that.
+*/
+#define SolvedFile "connect4_table.c"
+#define SolvedPlies 9
+
+typedef struct
+{
+	uint32_t Key;
+	int Move;
+}SolvedEntry;
+
+typedef struct
+{
+	SolvedEntry *Entries;
+	int Count;
+	int Size;
+	bool Full; // Out of memory, the table is incomplete
+	EngineSession *Fresh; // See CheckSolvedTable(), NULL to only solve
+	int Differ; // Scenes solved to other values on Fresh
+}SolvedTable;
+/* ForcedMove()
+ *
+ *A move that needs no search: a move that wins at once, otherwise 
+ *the block of a move that would make the opponent win at once 
+ *(the lowest column first). Returns -1 if there is none.
+*/
+int ForcedMove(RoundState *state)
+{
+	int x, code;
+	
+	for(x=0;x<=MaxX;x++)
+	{
+		if(state->Height[x] < ColumnHeight)
+		{
+			code = MakeMove(state, x, 0);
+			RetractMove(state, x, 0);
+			if(code != -1)
+			{
+				return x;
+			}
+		}
+	}
+	
+	// Pretend the opponent is to move
+	state->CurrentPlayer = Opponent(state->CurrentPlayer);
+	for(x=0;x<=MaxX;x++)
+	{
+		if(state->Height[x] < ColumnHeight)
+		{
+			code = MakeMove(state, x, 0);
+			RetractMove(state, x, 0);
+			if(code != -1)
+			{
+				break;
+			}
+		}
+	}
+	state->CurrentPlayer = Opponent(state->CurrentPlayer);
+	
+	return (x <= MaxX)?(x):(-1);
+}
+/* SolvedAdd()
+ *
+ *Add the perfect 'move' of the scene 'key' to 'table', doubling it 
+ *when it is full. Returns false if there is no memory left.
+*/
+bool SolvedAdd(SolvedTable *table, uint32_t key, int move)
+{
+	SolvedEntry *entries;
+	
+	if(table->Count == table->Size)
+	{
+		entries = (SolvedEntry*)realloc(table->Entries, 2 * (size_t)table->Size * sizeof(SolvedEntry));
+		if(entries == NULL)
+		{
+			table->Full = true;
+			return false;
+		}
+		table->Entries = entries;
+		table->Size *= 2;
+	}
+	
+	table->Entries[table->Count].Key = key;
+	table->Entries[table->Count].Move = move;
+	table->Count++;
+	
+	return true;
+}
+/* GameValue()
+ *
+ *1 for a win, -1 for a loss or 0 for a draw, by a solved 'score'.
+*/
+int GameValue(int score)
+{
+	return (IsWinScore(score))?(1):((IsWinScore(-score))?(-1):(0));
+}
+/* SolveScenes()
+ *
+ *The computer is to move: find its perfect move, then go on with 
+ *every answer of the user. The scenes are only collected into 
+ *'builder' to be visited once, the table itself is 'table'.
+*/
+void SolveScenes(BookBuilder *builder, SolvedTable *table, RoundState *state, int plies)
+{
+	uint32_t key;
+	int x, move, score, fresh, depth;
+	
+	if(state->Moves > plies || table->Full || !BookAdd(builder, state))
+	{
+		return;
+	}
+	
+	move = ForcedMove(state);
+	
+	if(move == -1)
+	{
+		move = DeepenBestMove(&Engine->Workers[0], *state, &score, BoardCells - state->Moves, 0, &depth);
+		
+		key = (uint32_t)(state->Board[PLAYER_B-1] + (state->Board[0] | state->Board[1]) + BottomRow);
+		
+		if(table->Fresh != NULL)
+		{
+			EngineNewGame(table->Fresh);
+			DeepenBestMove(&table->Fresh->Workers[0], *state, &fresh, BoardCells - state->Moves, 0, &depth);
+		}
+		if(table->Fresh != NULL && GameValue(fresh) != GameValue(score))
+		{
+			printf("Scene 0x%08lX is solved to other values.\n", (unsigned long)key);
+			table->Differ++;
+		}
+		
+		if(!SolvedAdd(table, key, move))
+		{
+			return;
+		}
+	}
+	
+	if(MakeMove(state, move, 0) == -1 && state->Moves < BoardCells)
+	{
+		for(x=0;x<=MaxX;x++)
+		{
+			if(state->Height[x] == ColumnHeight)
+			{
+				continue;
+			}
+			
+			if(MakeMove(state, x, 0) == -1 && state->Moves < BoardCells)
+			{
+				SolveScenes(builder, table, state, plies);
+			}
+			RetractMove(state, x, 0);
+		}
+	}
+	RetractMove(state, move, 0);
+}
+/* CompareSolved()
+ *
+ *qsort() order of the table: by Key.
+*/
+int CompareSolved(const void *a, const void *b)
+{
+	uint32_t ka = ((const SolvedEntry*)a)->Key;
+	uint32_t kb = ((const SolvedEntry*)b)->Key;
+	
+	return (ka > kb) - (ka < kb);
+}
+/* SolveAll()
+ *
+ *Walk every scene of "Solved Table" into 'table', whose Entries are 
+ *allocated, solving them on Engine. Returns false (said already) if 
+ *it cannot be finished.
+*/
+bool SolveAll(SolvedTable *table, int plies)
+{
+	BookBuilder builder;
+	RoundState state;
+	int x;
+	
+	if(BoardBits > 32)
+	{
+		printf("The board is too big, build with -DMaxX=5 -DMaxY=3.\n");
+		return false;
+	}
+	
+	builder.Slots = 1024;
+	builder.Count = 0;
+	builder.Entries = (BookEntry*)malloc(builder.Slots * sizeof(BookEntry));
+	builder.Scenes = (RoundState*)malloc(builder.Slots / 2 * sizeof(RoundState));
+	
+	if(builder.Entries == NULL || builder.Scenes == NULL || table->Entries == NULL)
+	{
+		printf("Not enough memory.\n");
+		free(builder.Entries);
+		free(builder.Scenes);
+		return false;
+	}
+	
+	memset(builder.Entries, 0xFF, builder.Slots * sizeof(BookEntry));
+	
+	// The computer starts
+	GameInit(&state, PLAYER_B);
+	SolveScenes(&builder, table, &state, plies);
+	
+	// The user starts
+	for(x=0;x<=MaxX;x++)
+	{
+		GameInit(&state, PLAYER_A);
+		MakeMove(&state, x, 0);
+		SolveScenes(&builder, table, &state, plies);
+	}
+	
+	free(builder.Entries);
+	free(builder.Scenes);
+	
+	if(table->Full)
+	{
+		printf("Not enough memory.\n");
+		return false;
+	}
+	
+	return true;
+}
+/* GenerateSolvedTable()
+ *
+ *See "Solved Table". Returns 0 on success.
+*/
+int GenerateSolvedTable(const char *path, int plies)
+{
+	SolvedTable table;
+	SolvedEntry *entries;
+	FILE *file;
+	int count, i;
+	
+	table.Size = 1024;
+	table.Count = 0;
+	table.Full = false;
+	table.Fresh = NULL;
+	table.Differ = 0;
+	table.Entries = (SolvedEntry*)malloc(table.Size * sizeof(SolvedEntry));
+	
+	if(!StartEngine(1))
+	{
+		free(table.Entries);
+		return 1;
+	}
+	EngineNewGame(Engine);
+	
+	if(!SolveAll(&table, plies))
+	{
+		free(table.Entries);
+		return 1;
+	}
+	
+	entries = table.Entries;
+	count = table.Count;
+	qsort(entries, count, sizeof(SolvedEntry), CompareSolved);
+	
+	file = fopen(path, "w");
+	if(file == NULL)
+	{
+		printf("Cannot write %s.\n", path);
+		free(table.Entries);
+		return 1;
+	}
+	
+	fprintf(file, "/* %s\n *\n", path);
+	fprintf(file, " *Generated by \"connect4 solve-gen\", do not edit.\n");
+	fprintf(file, " *Perfect moves of PLAYER_B on the %d * %d board, up to %d moves, %d scenes.\n", 
+	        MaxX+1, MaxY+1, plies, count);
+	fprintf(file, " *See \"Solved Table\" in connect4.c.\n*/\n");
+	fprintf(file, "#include \"connect4.h\"\n\n");
+	fprintf(file, "#if MaxX != %d || MaxY != %d || ConnectLength != %d\n", MaxX, MaxY, ConnectLength);
+	fprintf(file, "#error \"The table is made for another board.\"\n");
+	fprintf(file, "#endif\n\n");
+	fprintf(file, "const int SolvedCount = %d;\n", count);
+	fprintf(file, "const int SolvedPlies = %d;\n\n", plies);
+	
+	fprintf(file, "const uint32_t SolvedKeys[%d] PROGMEM = {", (count > 0)?(count):(1));
+	for(i=0;i<count;i++)
+	{
+		fprintf(file, "%s0x%08lX%s", (i % 6 == 0)?("\n  "):(""), (unsigned long)entries[i].Key, (i + 1 < count)?(", "):(""));
+	}
+	fprintf(file, "\n};\n\n");
+	
+	fprintf(file, "const uint8_t SolvedMoves[%d] PROGMEM = {", (count > 0)?((count + 1) / 2):(1));
+	for(i=0;i<count;i+=2)
+	{
+		fprintf(file, "%s0x%02X%s", (i % 24 == 0)?("\n  "):(""), 
+		        entries[i].Move | (((i + 1 < count)?(entries[i+1].Move):(0)) << 4), 
+		        (i + 2 < count)?(", "):(""));
+	}
+	fprintf(file, "\n};\n");
+	
+	fclose(file);
+	
+	printf("%s: %d scenes up to %d moves, %d bytes of flash.\n", path, count, plies, count * 4 + (count + 1) / 2);
+	
+	free(table.Entries);
+	return 0;
+}
+/* CheckSolvedTable()
+ *
+ *A regression check of the search: walk the scenes of "Solved Table" 
+ *like GenerateSolvedTable(), then walk them again on the same session, 
+ *which keeps its table all the way. So every scene is solved twice on 
+ *one session, and each time once more on a fresh session to compare 
+ *the game values (win, draw or loss). Returns 0 if they all agree.
+*/
+int CheckSolvedTable(int plies)
+{
+	SolvedTable table;
+	int pass;
+	
+	table.Size = 1024;
+	table.Full = false;
+	table.Fresh = EngineCreate(1, 0);
+	table.Differ = 0;
+	table.Entries = (SolvedEntry*)malloc(table.Size * sizeof(SolvedEntry));
+	
+	if(table.Fresh == NULL)
+	{
+		printf("Not enough memory.\n");
+		free(table.Entries);
+		return 1;
+	}
+	
+	if(!StartEngine(1))
+	{
+		EngineDestroy(table.Fresh);
+		free(table.Entries);
+		return 1;
+	}
+	EngineNewGame(Engine);
+	
+	for(pass=1;pass<=2;pass++)
+	{
+		table.Count = 0;
+		if(!SolveAll(&table, plies))
+		{
+			EngineDestroy(table.Fresh);
+			free(table.Entries);
+			return 1;
+		}
+		printf("Pass %d: %d scenes up to %d moves.\n", pass, table.Count, plies);
+	}
+	printf("%d of them solved to other values than on a fresh session.\n", table.Differ);
+	
+	EngineDestroy(table.Fresh);
+	free(table.Entries);
+	return (table.Differ == 0)?(0):(1);
+}
+/* Engine Server
+ *
+ *The engine as a long-lived service: "connect4 serve" reads requests 
+ *from stdin and answers on stdout, "connect4 serve <path>" does the 
+ *same for every client of the Unix socket 'path' (not on Windows). 
+ *One request or reply per line, words separated by spaces:
+ *
+ * new <game> [first] - Start game <game> (0 to ServerGames-1), 
+ *                      PLAYER_A (1, the default) or PLAYER_B (2) 
+ *                      moves first. Reply: new <game> ok
+ * play <game> <cols> - Play the columns, a digit each (see 
+ *                      PlayMoves()), all of them or none if one 
+ *                      is illegal. Reply: play <game> <moves> 
+ *                      <result>, the result as in ResultOf().
+ * go <game> <ms>     - Search the move of the game within <ms> 
+ *                      milliseconds (0 for no limit), like 
+ *                      DetermineBestMoveTimed(). The move is not 
+ *                      played. Reply: go <game> <column> <score> 
+ *                      <depth>
+ * stop <game>        - End the running search of the game early, 
+ *                      or else the first go of the game in line 
+ *                      that no stop is for yet, as soon as it 
+ *                      starts; that go replies at once. Reply: 
+ *                      none, or stop <game> idle if there is no 
+ *                      such go.
+ * stats [game]       - Reply: stats <game> and the Search 
+ *                      Statistics of its last go as FormatStats(), 
+ *                      or stats - and the totals of the server.
+ * end <game>         - Give the session of the game back. 
+ *                      Reply: end <game> ok
+ *
+ *Anything wrong is answered by error <game> <reason>, e.g. 
+ *error <game> game for a request to a game that new has not started.
+ *
+ *Requests are pipelined: a client does not wait for a reply before 
+ *it sends the next request. The requests of one game run in order, 
+ *the games run side by side on a fixed pool of ServerWorkers 
+ *threads, one per core. So replies of different games come in any 
+ *order, which is why each one names its game. stop and stats 
+ *without a game are answered at once, without waiting in line.
+ *
+ *Each game has a session of its own (see EngineSession) with one 
+ *thread and a table of ServerMemory, kept from move to move like 
+ *the session of the game at the keyboard, so thousands of games fit 
+ *in memory and each search starts from what the last one learned.
+*/
+#define ServerGames  65536
+#define ServerMemory (256 * 1024)
+#define ServerLine   256
+#define ServerText   (StatsText + 64)
+
+typedef struct
+{
+	FILE *In;
+	int Out;
+	Lock Write;
+	atomic_int Refs; // The reader and every request in line
+}ServerClient;
+
+typedef struct ServerRequest
+{
+	ServerClient *Client;
+	char Line[ServerLine];
+	struct ServerRequest *Next;
+}ServerRequest;
+
+typedef struct ServerGame
+{
+	int Id;
+	RoundState State;
+	EngineSession *Engine;   // NULL until new and after end
+	atomic_bool Stop;        // Signal of the search
+	bool Searching;
+	int Gos;                 // go requests in line
+	int Stops;               // stop requests for the first of them
+	RoundState Searched;     // The scene of the last go, for stats
+	bool Queued;             // In the ready line or being run
+	ServerRequest *First;    // Requests in line
+	ServerRequest *Last;
+	struct ServerGame *Next; // In the ready line
+}ServerGame;
+
+typedef struct
+{
+	Lock Lock;
+	Condition Ready;
+	ServerGame **Games;
+	ServerGame *First; // The ready line: games with requests to run
+	ServerGame *Last;
+	bool Closing;      // No more requests will come
+	int Pending;       // Requests in line or running
+	int Count;         // Games
+	int Sessions;      // Games with a session
+	int Workers;
+	long long Requests;
+	long long Searches;
+	long long Nodes;
+}EngineServer;
+
+EngineServer Server;
+/* ServerSend()
+ *
+ *Write the line 'text' to 'client', in one piece even when several 
+ *workers answer it at once.
+*/
+void ServerSend(ServerClient *client, const char *text)
+{
+	size_t length = strlen(text);
+	
+	LockAcquire(&client->Write);
+#ifdef _WIN32
+	fwrite(text, 1, length, stdout);
+	fflush(stdout);
+#else
+	while(length > 0)
+	{
+		ssize_t written = write(client->Out, text, length);
+		
+		if(written <= 0)
+		{
+			break;
+		}
+		text += written;
+		length -= written;
+	}
+#endif
+	LockRelease(&client->Write);
+}
+/* ServerRelease()
+ *
+ *Drop a reference to 'client'; the last one closes the connection.
+*/
+void ServerRelease(ServerClient *client)
+{
+	if(atomic_fetch_sub(&client->Refs, 1) == 1)
+	{
+		fclose(client->In);
+		LockFree(&client->Write);
+		free(client);
+	}
+}
+/* ServerRun()
+ *
+ *Run the request 'line' of 'game' and answer it. Only one worker 
+ *runs the requests of a game at a time.
+*/
+void ServerRun(ServerGame *game, ServerClient *client, const char *line)
+{
+	char command[16], moves[ServerLine], text[ServerText];
+	int id = game->Id, arg = 0, x, y, n, score, depth, code;
+	RoundState state;
+	
+	sscanf(line, "%15s %*d %d", command, &arg);
+	
+	// A stop that came while this go was in line is for this go
+	if(strcmp(command, "go") == 0)
+	{
+		LockAcquire(&Server.Lock);
+		atomic_store(&game->Stop, game->Stops > 0);
+		game->Stops -= (game->Stops > 0);
+		game->Gos--;
+		game->Searching = (game->Engine != NULL && ResultOf(&game->State) == ResultNone);
+		LockRelease(&Server.Lock);
+	}
+	
+	if(strcmp(command, "new") == 0)
+	{
+		if(game->Engine == NULL)
+		{
+			game->Engine = EngineCreate(1, ServerMemory);
+			if(game->Engine == NULL)
+			{
+				snprintf(text, sizeof(text), "error %d memory\n", id);
+				ServerSend(client, text);
+				return;
+			}
+			game->Engine->Workers[0].Signal = &game->Stop;
+			game->Engine->Book = (EngineBook.Header != NULL)?(&EngineBook):(NULL);
+			
+			LockAcquire(&Server.Lock);
+			Server.Sessions++;
+			LockRelease(&Server.Lock);
+		}
+		
+		GameInit(&game->State, (arg == PLAYER_B)?(PLAYER_B):(PLAYER_A));
+		EngineNewGame(game->Engine);
+		game->Searched = game->State;
+		snprintf(text, sizeof(text), "new %d ok\n", id);
+	}
+	else if(game->Engine == NULL)
+	{
+		snprintf(text, sizeof(text), "error %d game\n", id);
+	}
+	else if(strcmp(command, "play") == 0)
+	{
+		moves[0] = '\0';
+		sscanf(line, "%*s %*d %255s", moves);
+		text[0] = '\0';
+		
+		// All the moves or none: they are played on a copy first
+		state = game->State;
+		for(n=0;moves[n] != '\0';n++)
+		{
+			x = moves[n] - '0';
+			y = CalculateCoordinateY(&state, x);
+			if(y == -1 || ResultOf(&state) != ResultNone)
+			{
+				snprintf(text, sizeof(text), "error %d illegal %c\n", id, moves[n]);
+				break;
+			}
+			MakeMove(&state, x, y);
+		}
+		
+		if(text[0] == '\0')
+		{
+			game->State = state;
+			snprintf(text, sizeof(text), "play %d %d %d\n", id, game->State.Moves, ResultOf(&game->State));
+		}
+	}
+	else if(strcmp(command, "go") == 0)
+	{
+		// Not Searching when the game is over
+		if(!game->Searching)
+		{
+			snprintf(text, sizeof(text), "error %d over\n", id);
+			ServerSend(client, text);
+			return;
+		}
+		
+		x = DetermineBestMoveTimed(game->Engine, game->State, &code, (arg > 0)?(arg):(0), &depth);
+		score = game->Engine->Stats.Score;
+		
+		LockAcquire(&Server.Lock);
+		game->Searching = false;
+		Server.Searches++;
+		Server.Nodes += game->Engine->Stats.Nodes;
+		LockRelease(&Server.Lock);
+		
+		game->Searched = game->State;
+		
+		if(StatsLog != NULL)
+		{
+			PrintStats(StatsLog, &game->Engine->Stats, &game->State);
+		}
+		snprintf(text, sizeof(text), "go %d %d %d %d\n", id, x, score, depth);
+	}
+	else if(strcmp(command, "stats") == 0)
+	{
+		n = snprintf(text, sizeof(text), "stats %d ", id);
+		FormatStats(text + n, sizeof(text) - n - 1, &game->Engine->Stats, &game->Searched);
+		strcat(text, "\n");
+	}
+	else
+	{
+		EngineDestroy(game->Engine);
+		game->Engine = NULL;
+		
+		LockAcquire(&Server.Lock);
+		Server.Sessions--;
+		LockRelease(&Server.Lock);
+		
+		snprintf(text, sizeof(text), "end %d ok\n", id);
+	}
+	
+	ServerSend(client, text);
+}
+/* ServerWorker()
+ *
+ *What a worker of the pool does: take the first game of the ready 
+ *line, run its first request, and put the game back at the end of 
+ *the line if it has more. It ends when the server is closing and 
+ *nothing is left to run.
+*/
+ThreadRoutine(ServerWorker)
+{
+	ServerGame *game;
+	ServerRequest *request;
+	
+	(void)arg;
+	
+	LockAcquire(&Server.Lock);
+	
+	while(true)
+	{
+		while(Server.First == NULL && !(Server.Closing && Server.Pending == 0))
+		{
+			ConditionWait(&Server.Ready, &Server.Lock);
+		}
+		if(Server.First == NULL)
+		{
+			break;
+		}
+		
+		game = Server.First;
+		Server.First = game->Next;
+		request = game->First;
+		game->First = request->Next;
+		
+		LockRelease(&Server.Lock);
+		ServerRun(game, request->Client, request->Line);
+		ServerRelease(request->Client);
+		free(request);
+		LockAcquire(&Server.Lock);
+		
+		if(game->First != NULL)
+		{
+			game->Next = NULL;
+			if(Server.First == NULL)
+			{
+				Server.First = game;
+			}
+			else
+			{
+				Server.Last->Next = game;
+			}
+			Server.Last = game;
+			ConditionWake(&Server.Ready);
+		}
+		else
+		{
+			game->Queued = false;
+		}
+		
+		if(--Server.Pending == 0 && Server.Closing)
+		{
+			ConditionWakeAll(&Server.Ready);
+		}
+	}
+	
+	LockRelease(&Server.Lock);
+	
+	ThreadReturn;
+}
+/* ServerRequestLine()
+ *
+ *Take the request 'line' of 'client': answer it at once, or put it 
+ *in the line of its game.
+*/
+void ServerRequestLine(ServerClient *client, const char *line)
+{
+	char command[16], text[ServerText];
+	int id = -1, words;
+	ServerGame *game;
+	ServerRequest *request;
+	
+	words = sscanf(line, "%15s %d", command, &id);
+	if(words <= 0)
+	{
+		return;
+	}
+	
+	if(words == 1 && strcmp(command, "stats") == 0)
+	{
+		LockAcquire(&Server.Lock);
+		snprintf(text, sizeof(text), "stats - {\"games\":%d,\"sessions\":%d,\"workers\":%d,\"pending\":%d,"
+		         "\"requests\":%lld,\"searches\":%lld,\"nodes\":%lld}\n", 
+		         Server.Count, Server.Sessions, Server.Workers, Server.Pending, 
+		         Server.Requests, Server.Searches, Server.Nodes);
+		LockRelease(&Server.Lock);
+		ServerSend(client, text);
+		return;
+	}
+	
+	if(strcmp(command, "new") != 0 && strcmp(command, "play") != 0 && strcmp(command, "go") != 0 
+	   && strcmp(command, "stop") != 0 && strcmp(command, "stats") != 0 && strcmp(command, "end") != 0)
+	{
+		snprintf(text, sizeof(text), "error %d unknown %s\n", id, command);
+		ServerSend(client, text);
+		return;
+	}
+	if(words < 2 || id < 0 || id >= ServerGames)
+	{
+		snprintf(text, sizeof(text), "error %d game\n", id);
+		ServerSend(client, text);
+		return;
+	}
+	
+	LockAcquire(&Server.Lock);
+	
+	game = Server.Games[id];
+	
+	if(strcmp(command, "stop") == 0)
+	{
+		if(game != NULL && game->Searching && !atomic_load(&game->Stop))
+		{
+			atomic_store(&game->Stop, true);
+		}
+		else if(game != NULL && game->Stops < game->Gos)
+		{
+			game->Stops++;
+		}
+		else
+		{
+			snprintf(text, sizeof(text), "stop %d idle\n", id);
+			ServerSend(client, text);
+		}
+		LockRelease(&Server.Lock);
+		return;
+	}
+	
+	// Only new starts a game
+	if(game == NULL && strcmp(command, "new") != 0)
+	{
+		LockRelease(&Server.Lock);
+		snprintf(text, sizeof(text), "error %d game\n", id);
+		ServerSend(client, text);
+		return;
+	}
+	
+	request = (ServerRequest*)malloc(sizeof(ServerRequest));
+	if(game == NULL && request != NULL)
+	{
+		game = (ServerGame*)calloc(1, sizeof(ServerGame));
+		if(game != NULL)
+		{
+			game->Id = id;
+			Server.Games[id] = game;
+			Server.Count++;
+		}
+	}
+	if(request == NULL || game == NULL)
+	{
+		LockRelease(&Server.Lock);
+		free(request);
+		snprintf(text, sizeof(text), "error %d memory\n", id);
+		ServerSend(client, text);
+		return;
+	}
+	
+	request->Client = client;
+	snprintf(request->Line, sizeof(request->Line), "%s", line);
+	request->Next = NULL;
+	atomic_fetch_add(&client->Refs, 1);
+	
+	if(game->First == NULL)
+	{
+		game->First = request;
+	}
+	else
+	{
+		game->Last->Next = request;
+	}
+	game->Last = request;
+	Server.Pending++;
+	Server.Requests++;
+	
+	if(strcmp(command, "go") == 0)
+	{
+		game->Gos++;
+	}
+	
+	if(!game->Queued)
+	{
+		game->Queued = true;
+		game->Next = NULL;
+		if(Server.First == NULL)
+		{
+			Server.First = game;
+		}
+		else
+		{
+			Server.Last->Next = game;
+		}
+		Server.Last = game;
+		ConditionWake(&Server.Ready);
+	}
+	
+	LockRelease(&Server.Lock);
+}
+/* ServerClientMain()
+ *
+ *The reader of a client: take its requests line by line until it 
+ *hangs up.
+*/
+ThreadRoutine(ServerClientMain)
+{
+	ServerClient *client = (ServerClient*)arg;
+	char line[ServerLine];
+	
+	while(fgets(line, sizeof(line), client->In) != NULL)
+	{
+		ServerRequestLine(client, line);
+	}
+	
+	ServerRelease(client);
+	
+	ThreadReturn;
+}
+/* ServerClientNew()
+ *
+ *A client reading 'in' and answering to the descriptor 'out'.
+*/
+ServerClient* ServerClientNew(FILE *in, int out)
+{
+	ServerClient *client = (ServerClient*)malloc(sizeof(ServerClient));
+	
+	if(client != NULL)
+	{
+		client->In = in;
+		client->Out = out;
+		LockInit(&client->Write);
+		atomic_init(&client->Refs, 1);
+	}
+	
+	return client;
+}
+/* ServerListen()
+ *
+ *Accept clients on the Unix socket 'path', each with a reader thread 
+ *of its own, until the socket fails. Returns 0 on success.
+*/
+int ServerListen(const char *path)
+{
+#ifdef _WIN32
+	(void)path;
+	printf("Unix sockets are not supported here.\n");
+	return 1;
+#else
+	struct sockaddr_un address;
+	ServerClient *client;
+	ThreadHandle thread;
+	FILE *in;
+	int listener, fd;
+	
+	if(strlen(path) >= sizeof(address.sun_path))
+	{
+		printf("The socket path %s is too long.\n", path);
+		return 1;
+	}
+	
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+	unlink(path);
+	
+	listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(listener < 0 || bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 64) != 0)
+	{
+		printf("Cannot listen on %s.\n", path);
+		return 1;
+	}
+	
+	// A client that hangs up must not end the server on the next reply
+	signal(SIGPIPE, SIG_IGN);
+	
+	while((fd = accept(listener, NULL, NULL)) >= 0)
+	{
+		in = fdopen(fd, "r");
+		client = (in != NULL)?(ServerClientNew(in, fd)):(NULL);
+		if(client == NULL || !ThreadStart(&thread, ServerClientMain, client))
+		{
+			if(client != NULL)
+			{
+				LockFree(&client->Write);
+				free(client);
+			}
+			if(in != NULL)
+			{
+				fclose(in);
+			}
+			else
+			{
+				close(fd);
+			}
+			continue;
+		}
+		ThreadDetach(thread);
+	}
+	
+	close(listener);
+	return 1;
+#endif
+}
+/* Serve()
+ *
+ *Run the server on stdin and stdout, or on the Unix socket 'path' 
+ *if it is not NULL, see "Engine Server". On stdin it ends, after 
+ *answering everything, at the end of the input. Returns 0 on 
+ *success.
+*/
+int Serve(const char *path)
+{
+	ThreadHandle thread[MaxThreads];
+	ServerClient *client;
+	int i, started = 0, result = 0;
+	
+	memset(&Server, 0, sizeof(Server));
+	Server.Games = (ServerGame**)calloc(ServerGames, sizeof(ServerGame*));
+	if(Server.Games == NULL)
+	{
+		printf("Not enough memory.\n");
+		return 1;
+	}
+	LockInit(&Server.Lock);
+	ConditionInit(&Server.Ready);
+	BookOpen(&EngineBook, BookFile);
+	
+	Server.Workers = CountCores();
+	if(Server.Workers > MaxThreads)
+	{
+		Server.Workers = MaxThreads;
+	}
+	for(i=0;i<Server.Workers;i++)
+	{
+		started += ThreadStart(&thread[started], ServerWorker, NULL);
+	}
+	Server.Workers = started;
+	
+	if(path != NULL)
+	{
+		result = ServerListen(path);
+	}
+	else
+	{
+		client = ServerClientNew(stdin, 1);
+		if(client != NULL)
+		{
+			atomic_fetch_add(&client->Refs, 1); // stdin stays open
+			ServerClientMain(client);
+		}
+	}
+	
+	LockAcquire(&Server.Lock);
+	Server.Closing = true;
+	ConditionWakeAll(&Server.Ready);
+	LockRelease(&Server.Lock);
+	
+	for(i=0;i<started;i++)
+	{
+		ThreadJoin(thread[i]);
+	}
+	
+	for(i=0;i<ServerGames;i++)
+	{
+		if(Server.Games[i] != NULL)
+		{
+			EngineDestroy(Server.Games[i]->Engine);
+			free(Server.Games[i]);
+		}
+	}
+	free(Server.Games);
+	ConditionFree(&Server.Ready);
+	LockFree(&Server.Lock);
+	
+	return (started > 0)?(result):(1);
+}
+/* main()
+ *
+ *The entry point of the game.
+ *
+ *Command line:
+ * connect4            - Play the game.
+ * connect4 bench      - See Benchmark().
+ * connect4 smp-bench  - See SmpBenchmark().
+ * connect4 mcts-bench - See MctsBenchmark().
+ * connect4 playout-bench [games]
+ *                     - See PlayoutBenchmark(), PlayoutBenchGames 
+ *                       by default.
+ * connect4 self-play [games [depth [engine|dummy [file]]]]
+ *                     - See SelfPlay(), SelfPlayGames, SelfPlayDepth, 
+ *                       the engine and SelfPlayFile by default.
+ * connect4 records [file]
+ *                     - See ScanRecords(), GameFile by default.
+ * connect4 book-gen [file [plies [depth]]]
+ *                     - See GenerateBook(), BookFile, BookPlies 
+ *                       and BookDepth by default.
+ * connect4 solve-gen [file [plies]]
+ *                     - See GenerateSolvedTable(), SolvedFile and 
+ *                       SolvedPlies by default.
+ * connect4 solve-check [plies]
+ *                     - See CheckSolvedTable(), SolvedPlies by default.
+ * connect4 serve [socket]
+ *                     - See Serve(), on stdin and stdout by default.
+ *
+ *Adding --stats anywhere writes the Search Statistics of every 
+ *decision to stderr (see StatsLog).
+*/
+int main(int argc, char *argv[])
+{
+	RoundState game;
+	int choice, i;
+	
+	for(i=1;i<argc;i++)
+	{
+		if(strcmp(argv[i], "--stats") == 0)
+		{
+			StatsLog = stderr;
+		}
+	}
+	
+	if(argc > 1 && strcmp(argv[1], "bench") == 0)
+	{
+		return Benchmark();
+	}
+	if(argc > 1 && strcmp(argv[1], "smp-bench") == 0)
+	{
+		return SmpBenchmark();
+	}
+	if(argc > 1 && strcmp(argv[1], "mcts-bench") == 0)
+	{
+		return MctsBenchmark();
+	}
+	if(argc > 1 && strcmp(argv[1], "playout-bench") == 0)
+	{
+		return PlayoutBenchmark((argc > 2)?(atoi(argv[2])):(PlayoutBenchGames));
+	}
+	if(argc > 1 && strcmp(argv[1], "self-play") == 0)
+	{
+		return SelfPlay((argc > 2)?(atoi(argv[2])):(SelfPlayGames), 
+		                (argc > 3)?(atoi(argv[3])):(SelfPlayDepth), 
+		                (argc > 4 && strcmp(argv[4], "dummy") == 0), 
+		                (argc > 5)?(argv[5]):(SelfPlayFile));
+	}
+	if(argc > 1 && strcmp(argv[1], "records") == 0)
+	{
+		return ScanRecords((argc > 2)?(argv[2]):(GameFile));
+	}
+	if(argc > 1 && strcmp(argv[1], "book-gen") == 0)
+	{
+		return GenerateBook((argc > 2)?(argv[2]):(BookFile), 
+		                   (argc > 3)?(atoi(argv[3])):(BookPlies), 
+		                   (argc > 4)?(atoi(argv[4])):(BookDepth));
+	}
+	if(argc > 1 && strcmp(argv[1], "serve") == 0)
+	{
+		return Serve((argc > 2 && strcmp(argv[2], "--stats") != 0)?(argv[2]):(NULL));
+	}
+	if(argc > 1 && strcmp(argv[1], "solve-gen") == 0)
+	{
+		return GenerateSolvedTable((argc > 2)?(argv[2]):(SolvedFile), 
+		                           (argc > 3)?(atoi(argv[3])):(SolvedPlies));
+	}
+	if(argc > 1 && strcmp(argv[1], "solve-check") == 0)
+	{
+		return CheckSolvedTable((argc > 2)?(atoi(argv[2])):(SolvedPlies));
+	}
+	
+	BookOpen(&EngineBook, BookFile);
+	RecorderOpen(&GameLog, GameFile);
+	if(!StartEngine(0))
+	{
+		return 1;
+	}
+	GameSeed = (uint64_t)time(NULL);
+	ScreenInit();
+	
+	Guidance();
+	
+	// The main loop of the game.
+	
+	while(true)
+	{
+		choice = ModeHelper();
+		GameInit(&game, PLAYER_B);
+		EngineNewGame(Engine);
+		RecordStart(&GameLog, &game);
+		
+		ScreenNext();
+		
+		switch(choice)
+		{
+			case 1:
+				GameMain_EasyMode(&game);
+				break;
+				
+			case 2:
+				GameMain_HardMode(&game);
+				break;
+				
 			case 3:
 				GameMain_HellMode(&game);
 				break;
@@ -1036,9 +3147,15 @@ int main()
 			case 4:
 				GameMain_TwoPlayerMode(&game);
 				break;
+				
+			case 5:
+				GameMain_MonteCarloMode(&game);
+				break;
 		}
 		
-		switch(FindWinner(game))
+		RecordFinish(&GameLog, &game);
+		
+		switch(FindWinner(&game))
 		{
 			case -1:
 				printf("Tie.");
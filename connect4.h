@@ -8,18 +8,10 @@
 
 /* Domain of Coordinates
  *
- *Those two constants specify the 
- *maximum value that can be applied 
- *to this game.
- *
- *The domain is:
- *Any point at (0,0) to (6,5).
- *
- *The Coordinate System is shown below.
+ *The board (6 * 4 on the Arduino), the bitboards and the check of 
+ *a winner are shared with the desktop game, see connect4_board.h.
 */
-
-#define MaxX 5
-#define MaxY 3
+#include "connect4_board.h"
 
 //Player Flag
 typedef enum
@@ -81,15 +73,30 @@ typedef struct
 //extern int PossibleScenes;
 extern int VictoryProbability[MaxX+1];
 
-void DisplayScene(RoundState state);
+void DisplayScene(const RoundState *state);
 void MakeMove(RoundState *state, int x, int y);
 void RetractMove(RoundState *state, int x, int y);
-int FindWinner(RoundState state);
-int CalculateCoordinateY(RoundState state, int x);
-bool CheckNextStep(RoundState state, int x, int y);
+int FindWinner(const RoundState *state);
+int CalculateCoordinateY(const RoundState *state, int x);
+bool CheckNextStep(const RoundState *state, int x, int y);
 void GameInit(RoundState *state, PLAYER player);
 int DummyPlayer(RoundState *state);
-int DetermineBestMove(RoundState state, int *MoveRating);
+int DetermineBestMove(RoundState *state, int *MoveRating); // Searches on state in place, gives it back unchanged
+
+/* Solved Table
+ *
+ *Perfect moves of the computer for the first SolvedPlies moves, 
+ *generated by "connect4 solve-gen" into connect4_table.c and kept 
+ *in the flash memory. Nothing here calls SolvedBestMove(): the 
+ *DetermineBestMove() of the device sketch is meant to ask it first, 
+ *and only search when it returns -1.
+*/
+extern const int SolvedCount;
+extern const int SolvedPlies;
+extern const uint32_t SolvedKeys[] PROGMEM;
+extern const uint8_t SolvedMoves[] PROGMEM;
+
+int SolvedBestMove(const RoundState *state);
 //void Guidance();
 //int ModeHelper();
 //bool WaitForYesNo(char* hint);
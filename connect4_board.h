@@ -0,0 +1,196 @@
+#ifndef __CONNECT_4_BOARD__
+#define __CONNECT_4_BOARD__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Board Geometry -- Shared by connect4.c and the Arduino Version
+ *
+ *The size of the board and everything that only depends on it are
+ *written once here, as constants of the compiler, so every loop
+ *bound, shift and mask below is known when the code is compiled.
+ *
+ *Two boards are prepared:
+ * 7 * 6 - The desktop game (connect4.c).
+ * 6 * 4 - The Arduino version (connect4.h), chosen when the Arduino
+ *         IDE builds it, which defines ARDUINO.
+ *
+ *Any other board can be given on the command line of the compiler,
+ *e.g. -DMaxX=5 -DMaxY=3 to run the Arduino board on the desktop.
+*/
+
+/* Domain of Coordinates
+ *
+ *Those two constants specify the
+ *maximum value that can be applied
+ *to this game.
+ *
+ *The domain is:
+ *Any point at (0,0) to (MaxX,MaxY).
+ *
+ *The Coordinate System is shown at "Thorough Explanation of Scene".
+*/
+#ifdef ARDUINO
+#ifndef MaxX
+#define MaxX 5
+#endif
+#ifndef MaxY
+#define MaxY 3
+#endif
+#else
+#ifndef MaxX
+#define MaxX 6
+#endif
+#ifndef MaxY
+#define MaxY 5
+#endif
+#endif
+/* ConnectLength
+ *
+ *How many chess in a row win the game.
+ *
+ *FirstWinMove is the first move that can possibly win: the one
+ *who starts needs ConnectLength chess, and the other one has
+ *played one less by then.
+*/
+#ifndef ConnectLength
+#define ConnectLength 4
+#endif
+
+#define FirstWinMove (2*ConnectLength - 1)
+
+#if ConnectLength > MaxX+1 || ConnectLength > MaxY+1
+#error "ConnectLength does not fit the board."
+#endif
+/* Bitboard Layout
+ *
+ *The board is stored as one bit mask per player. Each column
+ *takes (MaxY+2) bits: (MaxY+1) bits for the blocks plus one spare
+ *bit on top, so that shifting a strand never wraps into the next
+ *column. Bit 0 of a column is the BOTTOM block, which is the
+ *opposite direction of the y-axis used by Scene (see SceneAt()).
+ *
+ *  6 13 20 27 34 41 48   <- spare bits
+ *  5 12 19 26 33 40 47   y = 0
+ *  4 11 18 25 32 39 46   y = 1
+ *  3 10 17 24 31 38 45   y = 2
+ *  2  9 16 23 30 37 44   y = 3
+ *  1  8 15 22 29 36 43   y = 4
+ *  0  7 14 21 28 35 42   y = 5
+ *
+ *A board that fits 32 bits (such as 6 * 4) uses 32-bit masks,
+ *which the 8-bit processor of the Arduino handles much faster.
+*/
+#define ColumnHeight (MaxY+1)
+#define ColumnBits   (MaxY+2)
+#define BoardCells   ((MaxX+1)*(MaxY+1))
+#define BoardBits    ((MaxX+1)*ColumnBits)
+
+#if BoardBits < 32
+typedef uint32_t Bitboard;
+#elif BoardBits < 64
+typedef uint64_t Bitboard;
+#else
+#error "The board does not fit 64 bits."
+typedef uint64_t Bitboard; // Only to keep the error above the only one
+#endif
+
+// Bit of the block (x,y) in Scene coordinates
+#define CellBit(x,y)   ((Bitboard)1 << ((x)*ColumnBits + (MaxY - (y))))
+// Bottom block of column x
+#define BottomBit(x)   ((Bitboard)1 << ((x)*ColumnBits))
+// All blocks of column x
+#define ColumnMask(x)  ((((Bitboard)1 << ColumnHeight) - 1) << ((x)*ColumnBits))
+// The bottom block of every column
+#define BottomRow      ((((Bitboard)1 << BoardBits) - 1) / (((Bitboard)1 << ColumnBits) - 1))
+// Every block of the board
+#define BoardMask      (BottomRow * (((Bitboard)1 << ColumnHeight) - 1))
+/* CenterOrder()
+ *
+ *The i-th column from the center outwards: 3, 2, 4, 1, 5, 0, 6 on
+ *the 7 * 6 board. Central columns belong to more strands.
+*/
+#define CenterOrder(i) ((MaxX+1)/2 + (((i) & 1)?(-((i)+1)/2):((i)/2)))
+/* Direction Matrix
+ *
+ *Used by FindWinner().
+ *
+ *Each value is the bit distance between two neighbouring blocks
+ *of a strand: vertical, horizontal, and the two diagonals. The
+ *opposite 4 directions are covered by the same shifts, because
+ *a strand read backwards is still the same strand.
+*/
+static const int Direction[4] = {1, ColumnBits, ColumnBits+1, ColumnBits-1};
+/* StrandStarts()
+ *
+ *Mark the first chess of every strand of ConnectLength along 'd'.
+ *
+ *b & (b >> d) marks every chess that has a neighbour along d, i.e.
+ *the start of a strand of 2. Each step doubles the strands found
+ *(2, 4, 8...), and a last step makes up the rest of ConnectLength.
+*/
+static inline Bitboard StrandStarts(Bitboard b, int d)
+{
+	int n;
+	
+	for(n=1; 2*n<=ConnectLength; n*=2)
+	{
+		b &= b >> (n*d);
+	}
+	if(n < ConnectLength)
+	{
+		b &= b >> ((ConnectLength-n)*d);
+	}
+	
+	return b;
+}
+/* Alignment()
+ *
+ *Check whether a bitboard contains ConnectLength connected chess.
+*/
+static inline bool Alignment(Bitboard b)
+{
+	int m;
+	
+	for(m=0;m<4;m++) // Direction
+	{
+		if(StrandStarts(b, Direction[m]))
+		{
+			// Winner strand is detected, no need to continue on.
+			return true;
+		}
+	}
+	
+	return false;
+}
+/* ConnectedThrough()
+ *
+ *Check only the 4 strands that pass the chess at bit 'move' of
+ *board b. Along each d, b is first cut down to the window of
+ *ConnectLength-1 blocks on both sides of 'move': every strand of
+ *ConnectLength in that window passes 'move', and no chess of the
+ *rest of the board is looked at.
+*/
+static inline bool ConnectedThrough(Bitboard b, Bitboard move)
+{
+	int m, k;
+	Bitboard window;
+	
+	for(m=0;m<4;m++) // Direction
+	{
+		window = move;
+		for(k=1;k<ConnectLength;k++)
+		{
+			window |= (move >> (k*Direction[m])) | (move << (k*Direction[m]));
+		}
+		
+		if(StrandStarts(b & window, Direction[m]))
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+#endif
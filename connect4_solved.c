@@ -0,0 +1,106 @@
+#include "connect4.h"
+
+/* Solved Table -- Perfect Moves from the Flash Memory
+ *
+ *The 6 * 4 board is solved on the desktop ("connect4 solve-gen",
+ *see "Solved Table" in connect4.c), and the table is written into
+ *connect4_table.c, which is kept in the flash memory with PROGMEM.
+ *
+ *Each scene the computer can face (up to SolvedPlies moves) is saved
+ *as its Key with its perfect move. The scenes where a move wins, or
+ *must block a win, are not saved: WinningColumn() below finds them.
+ *
+ *The boards are those of connect4_board.h, where a chess at (x,y)
+ *is CellBit(x,y): the columns one by one, from the bottom, with a
+ *spare block on top. Alignment() comes from there as well.
+*/
+
+/* WinningColumn()
+ *
+ *The lowest column where 'mine' wins at once, otherwise -1.
+*/
+static int WinningColumn(Bitboard mine, Bitboard all)
+{
+  Bitboard bit;
+  int x;
+
+  for(x=0;x<=MaxX;x++)
+  {
+    // The empty block above the top chess of column x
+    bit = (all + BottomBit(x)) & ColumnMask(x) & ~all;
+    if(bit != 0 && Alignment(mine | bit))
+    {
+      return x;
+    }
+  }
+
+  return -1;
+}
+
+/* SolvedBestMove()
+ *
+ *Find the move of the computer (PLAYER_B) without any search:
+ *a winning move, the block of the opponent, or a move of the
+ *table. Returns -1 if the scene is not in the table.
+ *
+ *The state is only read, so it is not copied onto the small stack.
+*/
+int SolvedBestMove(const RoundState *state)
+{
+  Bitboard mine = 0, theirs = 0, all, key;
+  int x, y, low, high, middle, move;
+
+  if(state->CurrentPlayer != PLAYER_B)
+  {
+    return -1;
+  }
+
+  for(x=0;x<=MaxX;x++)
+  {
+    for(y=0;y<=MaxY;y++)
+    {
+      if(state->Scene[y][x] == PLAYER_B)
+      {
+        mine |= CellBit(x, y);
+      }
+      else if(state->Scene[y][x] == PLAYER_A)
+      {
+        theirs |= CellBit(x, y);
+      }
+    }
+  }
+  all = mine | theirs;
+
+  move = WinningColumn(mine, all);
+  if(move == -1)
+  {
+    move = WinningColumn(theirs, all);
+  }
+  if(move != -1 || state->Moves > SolvedPlies)
+  {
+    return move;
+  }
+
+  // Binary search of the Key
+  key = mine + all + BottomRow;
+  low = 0;
+  high = SolvedCount - 1;
+  while(low <= high)
+  {
+    middle = low + (high - low) / 2;
+    if(pgm_read_dword(&SolvedKeys[middle]) < key)
+    {
+      low = middle + 1;
+    }
+    else if(pgm_read_dword(&SolvedKeys[middle]) > key)
+    {
+      high = middle - 1;
+    }
+    else
+    {
+      return (pgm_read_byte(&SolvedMoves[middle / 2]) >> (middle % 2)*4) & 0x0F;
+    }
+  }
+
+  return -1;
+}
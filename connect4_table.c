@@ -0,0 +1,590 @@
+/* connect4_table.c
+ *
+ *Generated by "connect4 solve-gen", do not edit.
+ *Perfect moves of PLAYER_B on the 6 * 4 board, up to 9 moves, 2731 scenes.
+ *See "Solved Table" in connect4.c.
+*/
+#include "connect4.h"
+
+#if MaxX != 5 || MaxY != 3 || ConnectLength != 4
+#error "The table is made for another board."
+#endif
+
+const int SolvedCount = 2731;
+const int SolvedPlies = 9;
+
+const uint32_t SolvedKeys[2731] PROGMEM = {
+  0x02108421, 0x02108422, 0x02108441, 0x02108821, 0x02108C24, 0x02108C42, 
+  0x02109422, 0x02109C28, 0x02109C44, 0x02109C58, 0x02109C82, 0x0210AC24, 
+  0x0210AC34, 0x0210AC38, 0x0210AC42, 0x0210AC4C, 0x0210AC9C, 0x0210ACC4, 
+  0x0210AD42, 0x0210AEC4, 0x0210B424, 0x0210B442, 0x0210CC2C, 0x0210CC5C, 
+  0x0210CCC2, 0x0210CDC4, 0x0210CEC2, 0x0210D422, 0x0210DC82, 0x0210DD84, 
+  0x0210DE82, 0x0210EC54, 0x0210ED44, 0x0210EE42, 0x02110421, 0x02110C22, 
+  0x02110C41, 0x02111421, 0x02111C24, 0x02111C38, 0x02111C42, 0x02112C2C, 
+  0x02112C5C, 0x02112CC2, 0x02112DC4, 0x02113422, 0x02113441, 0x02114C3C, 
+  0x02114DC2, 0x02115421, 0x02115C42, 0x02115D82, 0x02116C34, 0x02116D42, 
+  0x02118422, 0x02118441, 0x02118442, 0x02118481, 0x021184C2, 0x02118541, 
+  0x02118582, 0x021185C4, 0x021185D4, 0x02118681, 0x021186C2, 0x021186CC, 
+  0x02118821, 0x02118822, 0x02118841, 0x021188C1, 0x02118981, 0x021189C2, 
+  0x021189CC, 0x02118AC1, 0x02118AC5, 0x02118BC4, 0x02118C24, 0x02118C42, 
+  0x02119021, 0x021191C1, 0x021192C3, 0x021193C2, 0x02119422, 0x02119822, 
+  0x02119841, 0x02119982, 0x02119A81, 0x02119C84, 0x02119E84, 0x0211A821, 
+  0x0211A981, 0x0211AC44, 0x0211AC58, 0x0211AD84, 0x0211B022, 0x0211B041, 
+  0x0211B1C2, 0x0211B2C1, 0x0211B824, 0x0211B842, 0x0211B881, 0x0211B982, 
+  0x0211BA81, 0x0211CC38, 0x0211D021, 0x0211D1C1, 0x0211D822, 0x0211D82A, 
+  0x0211D841, 0x0211D846, 0x0211D981, 0x0211E822, 0x0211E841, 0x0211E8C2, 
+  0x0211E941, 0x0211E982, 0x0211EA81, 0x0211F844, 0x0211F882, 0x02120C21, 
+  0x02123421, 0x02127422, 0x02127441, 0x02128421, 0x02128441, 0x021284C1, 
+  0x02128581, 0x021285C2, 0x021285CC, 0x02128821, 0x021289C1, 0x02128AC3, 
+  0x02128BC2, 0x02128C22, 0x02128C41, 0x02129421, 0x02129821, 0x02129981, 
+  0x02129C42, 0x02129C44, 0x02129C58, 0x02129C81, 0x02129D84, 0x0212AC38, 
+  0x0212AC41, 0x0212B021, 0x0212B1C1, 0x0212B822, 0x0212B841, 0x0212B981, 
+  0x0212D821, 0x0212D826, 0x0212DC42, 0x0212DC81, 0x0212E821, 0x0212E8C1, 
+  0x0212E981, 0x0212F022, 0x0212F041, 0x0212F824, 0x0212F842, 0x02130C24, 
+  0x02130C42, 0x02130C81, 0x02131422, 0x02131441, 0x02131C44, 0x02131C54, 
+  0x02131C58, 0x02131C8C, 0x02132C24, 0x02132C34, 0x02132C38, 0x02132C4C, 
+  0x02132CC4, 0x02133424, 0x02133442, 0x02133481, 0x02134C2C, 0x02135422, 
+  0x02135441, 0x021354C2, 0x02135541, 0x02135C44, 0x02135C82, 0x02138444, 
+  0x02138482, 0x02138542, 0x02138584, 0x02138641, 0x02138682, 0x0213868A, 
+  0x02138824, 0x02138842, 0x02138881, 0x02138941, 0x02138982, 0x02138A81, 
+  0x02138A86, 0x02138B42, 0x02138B84, 0x02138C44, 0x02138C82, 0x02138E42, 
+  0x02139022, 0x02139041, 0x02139181, 0x02139341, 0x02139442, 0x02139641, 
+  0x02139844, 0x02139858, 0x02139882, 0x02139984, 0x02139A82, 0x02139C84, 
+  0x0213A824, 0x0213A838, 0x0213A842, 0x0213A886, 0x0213A982, 0x0213AA81, 
+  0x0213AC44, 0x0213AC84, 0x0213B024, 0x0213B042, 0x0213B081, 0x0213CC44, 
+  0x0213D022, 0x0213D041, 0x0213E824, 0x0213E842, 0x0213F044, 0x02148C21, 
+  0x02149C41, 0x0214B821, 0x0214DC41, 0x0214F021, 0x02150C22, 0x02150C41, 
+  0x02151C24, 0x02151C38, 0x02151C42, 0x02151C4C, 0x02151C81, 0x02151CC4, 
+  0x02152C22, 0x02152C2A, 0x02152C2C, 0x02152C41, 0x02152D41, 0x02153422, 
+  0x02153441, 0x02154C26, 0x02154CC1, 0x02155421, 0x021554C1, 0x02155C24, 
+  0x02155C42, 0x02155C81, 0x02158442, 0x02158541, 0x02158582, 0x02158681, 
+  0x02158686, 0x02158784, 0x02158822, 0x02158841, 0x02158981, 0x02158B41, 
+  0x02158C42, 0x02158E41, 0x02159824, 0x02159838, 0x02159842, 0x02159881, 
+  0x02159982, 0x02159A81, 0x02159C44, 0x0215A822, 0x0215A82A, 0x0215A841, 
+  0x0215A981, 0x0215AC44, 0x0215B022, 0x0215B041, 0x0215B844, 0x0215C826, 
+  0x0215D021, 0x0215D824, 0x0215E822, 0x0215E842, 0x0215E881, 0x0215F024, 
+  0x02160C22, 0x02160C41, 0x02161421, 0x02161C24, 0x02161C42, 0x02161C81, 
+  0x02162C22, 0x02162C41, 0x02165C24, 0x02165C81, 0x02166C24, 0x02166C42, 
+  0x02166C81, 0x02167424, 0x02167442, 0x02167481, 0x02168442, 0x02168481, 
+  0x021684C2, 0x02168541, 0x02168582, 0x021685C4, 0x02168681, 0x021686C2, 
+  0x02168822, 0x02168841, 0x021688C1, 0x021688C5, 0x02168943, 0x02168981, 
+  0x021689C2, 0x02168AC1, 0x02169021, 0x021690C3, 0x021691C1, 0x02169824, 
+  0x02169842, 0x02169982, 0x02169A81, 0x02169C84, 0x0216A822, 0x0216A981, 
+  0x0216AC44, 0x0216B824, 0x0216B842, 0x0216B844, 0x0216B881, 0x0216D822, 
+  0x0216D824, 0x0216D841, 0x0216E824, 0x0216E842, 0x0216F024, 0x0216F042, 
+  0x0216F081, 0x02170C44, 0x02170C82, 0x02170F02, 0x02171442, 0x02171481, 
+  0x02171701, 0x02171C84, 0x02172C44, 0x02173444, 0x02173482, 0x02175442, 
+  0x02175481, 0x02191C22, 0x02191C41, 0x02191D41, 0x02192C26, 0x02192CC1, 
+  0x02195C22, 0x02199822, 0x0219982A, 0x02199841, 0x02199941, 0x02199981, 
+  0x0219A826, 0x0219A8C1, 0x0219B824, 0x0219E841, 0x021A0C21, 0x021A1C22, 
+  0x021A1C41, 0x021A2C21, 0x021A5C22, 0x021A6C22, 0x021A6C41, 0x021A7422, 
+  0x021A7441, 0x021A8441, 0x021A84C1, 0x021A8581, 0x021A8585, 0x021A85C2, 
+  0x021A8683, 0x021A86C1, 0x021A8821, 0x021A88C3, 0x021A8983, 0x021A89C1, 
+  0x021A9822, 0x021A9841, 0x021A9981, 0x021A9C44, 0x021AA821, 0x021AB822, 
+  0x021AB824, 0x021AB841, 0x021AD821, 0x021AE822, 0x021AE841, 0x021AF022, 
+  0x021AF041, 0x021B0C42, 0x021B0C81, 0x021B0F01, 0x021B1C44, 0x021B3442, 
+  0x021B3481, 0x021B8444, 0x021B8544, 0x021B88C4, 0x021B9181, 0x021B9442, 
+  0x021B9844, 0x021BA824, 0x021BB042, 0x021BB081, 0x021BD022, 0x021BD041, 
+  0x021C7422, 0x021C7441, 0x021CB822, 0x021CB841, 0x021CD821, 0x021CF022, 
+  0x021CF041, 0x021D3424, 0x021D3442, 0x021D3481, 0x021D5422, 0x021D5441, 
+  0x021D8444, 0x021D8454, 0x021D8482, 0x021D848C, 0x021D8542, 0x021D8584, 
+  0x021D8641, 0x021D8682, 0x021D8842, 0x021D884C, 0x021D8941, 0x021D8982, 
+  0x021D8A81, 0x021D9844, 0x021D9882, 0x021DA842, 0x021DB024, 0x021DB042, 
+  0x021DB081, 0x021DD022, 0x021DD041, 0x021E1422, 0x021E1441, 0x021E1C44, 
+  0x021E1C82, 0x021E2421, 0x021E2C42, 0x021E6422, 0x021E6441, 0x021E8542, 
+  0x021E8584, 0x021E8641, 0x021E8682, 0x021E8842, 0x021E8881, 0x021E8941, 
+  0x021E8982, 0x021E9022, 0x021E902A, 0x021E9041, 0x021E9046, 0x021E9844, 
+  0x021E9882, 0x021EA842, 0x021EA881, 0x021EB042, 0x021EB081, 0x021ED041, 
+  0x021EE022, 0x021EE041, 0x021F0C84, 0x021F1482, 0x02208421, 0x02208C22, 
+  0x02208C41, 0x02209421, 0x02209C24, 0x02209C38, 0x02209C42, 0x02209C81, 
+  0x0220AC22, 0x0220AC2C, 0x0220AC41, 0x0220AC5C, 0x0220ACC2, 0x0220ADC4, 
+  0x0220B422, 0x0220B441, 0x0220CC3C, 0x0220CDC2, 0x0220D421, 0x0220D425, 
+  0x0220D443, 0x0220D4C5, 0x0220D543, 0x0220DC81, 0x0220DD82, 0x0220EC24, 
+  0x0220EC34, 0x0220EC42, 0x0220EC4C, 0x0220ECC4, 0x0220ED42, 0x0220F424, 
+  0x0220F442, 0x0220F481, 0x02210C21, 0x02211C22, 0x02211C41, 0x02213421, 
+  0x02215423, 0x022154C3, 0x02216C22, 0x02216C2C, 0x02216CC2, 0x02217422, 
+  0x02217441, 0x022174C2, 0x02217541, 0x02218421, 0x02218441, 0x022184C1, 
+  0x02218581, 0x022185C2, 0x022185CC, 0x022186C1, 0x022186C5, 0x02218821, 
+  0x022189C1, 0x022189C5, 0x02218AC3, 0x02218BC2, 0x02218C22, 0x02218DC4, 
+  0x02218EC2, 0x022191C3, 0x022195C2, 0x02219821, 0x02219981, 0x02219C44, 
+  0x02219C58, 0x02219D84, 0x0221AC38, 0x0221B021, 0x0221B1C1, 0x0221B822, 
+  0x0221B841, 0x0221B981, 0x0221D821, 0x0221D826, 0x0221D862, 0x0221D8A1, 
+  0x0221E821, 0x0221E8C1, 0x0221E981, 0x0221F824, 0x0221F842, 0x02227421, 
+  0x022274C1, 0x022285C1, 0x022286C3, 0x022289C3, 0x02228C21, 0x02228DC2, 
+  0x02229C41, 0x0222B821, 0x0222D861, 0x0222DC41, 0x0222F021, 0x0222F822, 
+  0x02230C22, 0x02230C41, 0x02231421, 0x02231C24, 0x02231C34, 0x02231C38, 
+  0x02231C42, 0x02231C4C, 0x02231C81, 0x02232C22, 0x02232C2C, 0x02232C41, 
+  0x02233422, 0x02233441, 0x022334C2, 0x02233541, 0x02235421, 0x02235425, 
+  0x02235443, 0x022354C1, 0x02235C42, 0x02235C81, 0x02236C24, 0x02236C42, 
+  0x02237424, 0x02237442, 0x02238442, 0x02238481, 0x02238541, 0x02238582, 
+  0x02238681, 0x02238686, 0x02238784, 0x02238822, 0x02238841, 0x02238981, 
+  0x02238B41, 0x02238C42, 0x02238D42, 0x02238E41, 0x02239021, 0x02239541, 
+  0x02239824, 0x02239838, 0x02239842, 0x02239881, 0x02239982, 0x02239A81, 
+  0x02239C44, 0x02239C82, 0x02239C84, 0x0223A822, 0x0223A841, 0x0223A981, 
+  0x0223AC42, 0x0223AC44, 0x0223B022, 0x0223B041, 0x0223B842, 0x0223B881, 
+  0x0223D021, 0x0223D025, 0x0223D043, 0x0223D841, 0x0223E822, 0x0223E841, 
+  0x0223E842, 0x0223E881, 0x0223F024, 0x0223F042, 0x0223F081, 0x02250C21, 
+  0x02251C22, 0x02251C2C, 0x02251C41, 0x02252C21, 0x02252C26, 0x02253421, 
+  0x022534C1, 0x02255423, 0x02256C22, 0x02257422, 0x02258441, 0x02258581, 
+  0x02258821, 0x02258D41, 0x02259822, 0x02259841, 0x02259981, 0x02259C42, 
+  0x02259C44, 0x0225A821, 0x0225A826, 0x0225B021, 0x0225B824, 0x0225B841, 
+  0x0225D023, 0x0225E821, 0x0225E841, 0x0225F022, 0x0225F041, 0x02260C21, 
+  0x02261C22, 0x02261C41, 0x02262C21, 0x02266C22, 0x02266C41, 0x02267422, 
+  0x02267441, 0x02268441, 0x022684C1, 0x02268581, 0x022685C2, 0x022686C1, 
+  0x02268782, 0x02268821, 0x022688C3, 0x022689C1, 0x02268B81, 0x02268C22, 
+  0x02268C41, 0x02269421, 0x02269822, 0x02269981, 0x02269C44, 0x0226B422, 
+  0x0226B441, 0x0226B822, 0x0226B824, 0x0226B841, 0x0226B842, 0x0226D421, 
+  0x0226D821, 0x0226D822, 0x0226E822, 0x0226F022, 0x0226F041, 0x02270C42, 
+  0x02270C81, 0x02270F01, 0x02271C44, 0x02271C82, 0x02272C42, 0x02272C81, 
+  0x02273442, 0x02273481, 0x02291C21, 0x02299821, 0x02299826, 0x022A1C21, 
+  0x022A5C21, 0x022A6C21, 0x022A7421, 0x022A8583, 0x022A85C1, 0x022A8781, 
+  0x022A8C21, 0x022A9821, 0x022AB421, 0x022AB821, 0x022AB822, 0x022AE821, 
+  0x022AF021, 0x022B1C42, 0x022B1C81, 0x022B84C4, 0x022C7421, 0x022CB821, 
+  0x022CF021, 0x022D3422, 0x022D3441, 0x022D5421, 0x022D8442, 0x022D844C, 
+  0x022D8541, 0x022D8582, 0x022D8681, 0x022D8981, 0x022D9842, 0x022DB022, 
+  0x022DB041, 0x022DD021, 0x022E1421, 0x022E1C24, 0x022E1C42, 0x022E1C81, 
+  0x022E2C22, 0x022E2C41, 0x022E3422, 0x022E3441, 0x022E5421, 0x022E6421, 
+  0x022E8541, 0x022E8582, 0x022E8822, 0x022E8841, 0x022E9021, 0x022E9026, 
+  0x022E9824, 0x022E9842, 0x022E9881, 0x022EA822, 0x022EA841, 0x022EB022, 
+  0x022EB041, 0x022ED021, 0x022EE021, 0x022F0C82, 0x0230B444, 0x0230B458, 
+  0x0230B482, 0x0230D424, 0x0230D438, 0x0230D442, 0x0230F484, 0x02313424, 
+  0x02313438, 0x02313442, 0x02315422, 0x02317482, 0x023186C4, 0x02318AC2, 
+  0x0231D842, 0x0231D881, 0x023286C2, 0x0232D841, 0x0232E822, 0x0232E841, 
+  0x02333444, 0x02333482, 0x02335424, 0x02335442, 0x02338544, 0x02338642, 
+  0x02338942, 0x0234E821, 0x02353424, 0x02353442, 0x02355422, 0x02358542, 
+  0x02368682, 0x02368A81, 0x023A8681, 0x02408C21, 0x02409C22, 0x02409C41, 
+  0x0240B421, 0x0240D423, 0x0240D4C3, 0x0240EC22, 0x0240EC2C, 0x0240ECC2, 
+  0x0240F422, 0x0240F441, 0x0240F4C2, 0x0240F541, 0x02417421, 0x024174C1, 
+  0x024185C1, 0x024186C3, 0x024189C3, 0x02418DC2, 0x0241B821, 0x0241B862, 
+  0x0241B8A1, 0x0241D861, 0x0241F822, 0x0242B861, 0x02430C21, 0x02431C22, 
+  0x02431C2C, 0x02431C41, 0x02432CC1, 0x02433421, 0x024334C1, 0x02435423, 
+  0x02436C22, 0x02437422, 0x02437441, 0x02438441, 0x02438581, 0x02438821, 
+  0x02438D41, 0x02439822, 0x02439841, 0x02439981, 0x02439C42, 0x02439C44, 
+  0x0243A821, 0x0243B021, 0x0243B841, 0x0243B842, 0x0243B881, 0x0243D023, 
+  0x0243D841, 0x0243E821, 0x0243E841, 0x0243F022, 0x0243F041, 0x02451C21, 
+  0x02451CC1, 0x02457421, 0x02459821, 0x0245B822, 0x0245B841, 0x02461C21, 
+  0x02465C21, 0x02466C21, 0x02467421, 0x024685C1, 0x02468781, 0x02468C21, 
+  0x02468C62, 0x0246B421, 0x0246B821, 0x0246B822, 0x0246F021, 0x02470C22, 
+  0x02470C41, 0x02471421, 0x02471C42, 0x02471C81, 0x0249B821, 0x024B0C21, 
+  0x024B9822, 0x024BA821, 0x024BB021, 0x024D3421, 0x024D8581, 0x024DB021, 
+  0x024E1C22, 0x024E1C41, 0x024E3421, 0x024E8821, 0x024E9822, 0x024E9841, 
+  0x024EA821, 0x024EB021, 0x024F1422, 0x024F1441, 0x024F2421, 0x0250B424, 
+  0x0250B438, 0x0250B442, 0x0250D422, 0x0250F444, 0x0250F482, 0x02517442, 
+  0x025186C2, 0x0251D841, 0x0252E821, 0x02533424, 0x02533442, 0x02535422, 
+  0x02538542, 0x02568681, 0x02609C44, 0x02609C54, 0x02609C58, 0x02609C82, 
+  0x02609C8C, 0x0260AC24, 0x0260AC38, 0x0260AC42, 0x0260AC4C, 0x0260AC81, 
+  0x0260ACC4, 0x0260AD42, 0x0260AD82, 0x0260AE81, 0x0260CC41, 0x0260CCC2, 
+  0x0260CD41, 0x0260CD81, 0x0260D429, 0x0260D445, 0x0260DC82, 0x0260EC44, 
+  0x0260F444, 0x0260F482, 0x02611C24, 0x02611C38, 0x02611C42, 0x02611C4C, 
+  0x02612C41, 0x02612D81, 0x02615425, 0x02615C42, 0x02615C81, 0x02616C24, 
+  0x02617424, 0x02617442, 0x02617481, 0x02618422, 0x02618441, 0x02618821, 
+  0x02618C24, 0x02618C42, 0x02619422, 0x0261B424, 0x0261B442, 0x0261D422, 
+  0x02628421, 0x02628C22, 0x0262B422, 0x02632C24, 0x02632C81, 0x02638444, 
+  0x02638482, 0x02638584, 0x02638682, 0x02638842, 0x02638982, 0x02638A81, 
+  0x02638C44, 0x02638C82, 0x02639424, 0x02639442, 0x0263A824, 0x0263C822, 
+  0x02651C24, 0x02652C22, 0x02654C21, 0x02658442, 0x02658481, 0x02658582, 
+  0x02658681, 0x02658841, 0x02658981, 0x02658C24, 0x02658C42, 0x02659824, 
+  0x02659881, 0x0265A822, 0x0265C821, 0x02668422, 0x02668441, 0x02668442, 
+  0x02668481, 0x02668821, 0x02668841, 0x02668C24, 0x02668C42, 0x02668C81, 
+  0x02669422, 0x02669441, 0x02691C22, 0x02692C21, 0x02698441, 0x026984C2, 
+  0x02698541, 0x02698581, 0x02699822, 0x0269A821, 0x026A8421, 0x026A8441, 
+  0x026A8C22, 0x026A8C41, 0x026A9421, 0x026A9822, 0x026A9841, 0x026AA821, 
+  0x026B8444, 0x026B8842, 0x026D8444, 0x026D8482, 0x026D8842, 0x0290F442, 
+  0x02A09C24, 0x02A09C38, 0x02A09C42, 0x02A09C4C, 0x02A0AC41, 0x02A0ACC2, 
+  0x02A0AD41, 0x02A0AD81, 0x02A0CCC1, 0x02A0D425, 0x02A0DC24, 0x02A0DC42, 
+  0x02A0DC81, 0x02A0EC24, 0x02A0F424, 0x02A0F442, 0x02A0F481, 0x02A18421, 
+  0x02A18C22, 0x02A19C24, 0x02A19C42, 0x02A1AC22, 0x02A1B422, 0x02A29C22, 
+  0x02A31C24, 0x02A38442, 0x02A38582, 0x02A38681, 0x02A38C24, 0x02A38C42, 
+  0x02A39824, 0x02A3A822, 0x02A51C22, 0x02A52C21, 0x02A58441, 0x02A58581, 
+  0x02A59822, 0x02A5A821, 0x02A68421, 0x02A68441, 0x02A68462, 0x02A684A1, 
+  0x02A68861, 0x02A68C22, 0x02A68C41, 0x02A91C21, 0x02A984C1, 0x02A99821, 
+  0x02AA8461, 0x02AA8C21, 0x02AA9821, 0x02AB8442, 0x02AD8442, 0x02C08C22, 
+  0x02C08C41, 0x02C09421, 0x02C09C24, 0x02C09C34, 0x02C09C42, 0x02C09C4C, 
+  0x02C09C81, 0x02C09CC4, 0x02C09D42, 0x02C09D82, 0x02C09E81, 0x02C0AC22, 
+  0x02C0AC2C, 0x02C0AC41, 0x02C0ACC2, 0x02C0AD81, 0x02C0B422, 0x02C0B441, 
+  0x02C0D421, 0x02C0EC24, 0x02C0EC42, 0x02C0EC81, 0x02C0F424, 0x02C0F442, 
+  0x02C10C21, 0x02C11C22, 0x02C11C2C, 0x02C11C41, 0x02C11CC2, 0x02C11D81, 
+  0x02C12C21, 0x02C13421, 0x02C16C22, 0x02C16C41, 0x02C17422, 0x02C17441, 
+  0x02C185C2, 0x02C186C1, 0x02C189C1, 0x02C21C21, 0x02C25C21, 0x02C27421, 
+  0x02C285C1, 0x02C31C24, 0x02C31C42, 0x02C31C81, 0x02C32C22, 0x02C32C41, 
+  0x02C34C21, 0x02C38442, 0x02C38481, 0x02C38582, 0x02C38681, 0x02C38841, 
+  0x02C38981, 0x02C38C44, 0x02C38C82, 0x02C39442, 0x02C39842, 0x02C39881, 
+  0x02C3A841, 0x02C51C22, 0x02C51C41, 0x02C52C21, 0x02C58441, 0x02C58581, 
+  0x02C58C42, 0x02C59841, 0x02C70C24, 0x02C70C42, 0x02C70C81, 0x02C71422, 
+  0x02C71441, 0x02C91C21, 0x02CB0C22, 0x02CB0C41, 0x02CB1421, 0x02CD8442, 
+  0x02CD8481, 0x02CD8841, 0x02E18424, 0x02E18442, 0x02E18481, 0x02E184C4, 
+  0x02E18542, 0x02E18582, 0x02E18681, 0x02E18822, 0x02E18841, 0x02E188C2, 
+  0x02E18981, 0x02E19021, 0x02E1B022, 0x02E1B041, 0x02E1D021, 0x02E28422, 
+  0x02E28441, 0x02E284C2, 0x02E28581, 0x02E28821, 0x02E2B021, 0x02E68424, 
+  0x02E68442, 0x02E68481, 0x02E68822, 0x02E68841, 0x02E69021, 0x02EA8422, 
+  0x02EA8441, 0x02EA8821, 0x0320ACC1, 0x03219C22, 0x03268461, 0x03408C21, 
+  0x03409C22, 0x03409C2A, 0x03409C2C, 0x03409C41, 0x03409C46, 0x03409CC2, 
+  0x03409D41, 0x03409D81, 0x0340AC21, 0x0340AC26, 0x0340ACC1, 0x0340B421, 
+  0x0340B462, 0x0340B4A1, 0x0340D461, 0x0340EC22, 0x0340EC41, 0x0340F422, 
+  0x03411C21, 0x03411C26, 0x03411CC1, 0x03413461, 0x03416C21, 0x03417421, 
+  0x034185C1, 0x03431C22, 0x03431C41, 0x03432C21, 0x03438441, 0x03438581, 
+  0x03438C42, 0x03438C81, 0x03439841, 0x03451C21, 0x03470C22, 0x03470C41, 
+  0x034B0C21, 0x034D8441, 0x03618422, 0x03618441, 0x036184C2, 0x03618581, 
+  0x03618821, 0x03618862, 0x036188A1, 0x03619061, 0x0361B021, 0x03628861, 
+  0x03668422, 0x03668441, 0x03668821, 0x036A8421, 0x0380F422, 0x0380F441, 
+  0x03817421, 0x03839822, 0x03839841, 0x0383A821, 0x03859821, 0x03870C22, 
+  0x03870C41, 0x03871421, 0x038B0C21, 0x03A18422, 0x03A18441, 0x03A18821, 
+  0x03A19822, 0x03A19841, 0x03A1A821, 0x03A28421, 0x03A28C22, 0x03A28C41, 
+  0x03A29421, 0x03A29821, 0x03A38424, 0x03A38442, 0x03A38481, 0x03A38822, 
+  0x03A38841, 0x03A48C21, 0x03A58422, 0x03A58441, 0x03A58442, 0x03A58481, 
+  0x03A58841, 0x03A68442, 0x03A68481, 0x03A68841, 0x03A98441, 0x03AA8441, 
+  0x03C0B442, 0x03C0B481, 0x03C0D441, 0x03C13441, 0x03E18444, 0x03E18824, 
+  0x03E28424, 0x04108421, 0x04108C22, 0x04109C24, 0x04109C38, 0x04109C42, 
+  0x04109CC4, 0x04109D42, 0x04109EC4, 0x04109F44, 0x0410AC22, 0x0410AC2C, 
+  0x0410AC5C, 0x0410AC74, 0x0410ACAC, 0x0410ACC2, 0x0410ADC4, 0x0410AEC2, 
+  0x0410AF42, 0x0410B422, 0x0410CC3C, 0x0410CC6C, 0x0410CDC2, 0x0410DC24, 
+  0x0410DC38, 0x0410DD82, 0x0410EC24, 0x0410EC34, 0x0410EC42, 0x0410EC4C, 
+  0x0410ECC4, 0x0410ED42, 0x0410F424, 0x0410F442, 0x04110C21, 0x04111C22, 
+  0x04111C41, 0x04111CC2, 0x04111DC4, 0x04111F42, 0x04112C21, 0x04112C6C, 
+  0x04112DC2, 0x04113421, 0x04116C22, 0x04116C2C, 0x04116CC2, 0x04117422, 
+  0x04118421, 0x04118422, 0x04118441, 0x04118462, 0x041184A1, 0x041184C1, 
+  0x04118581, 0x041185C2, 0x041185CC, 0x041186C1, 0x041186C5, 0x041187C4, 
+  0x04118821, 0x04118861, 0x041188E2, 0x04118961, 0x041189C1, 0x04118AC3, 
+  0x04118AE2, 0x04118BC2, 0x04118C22, 0x041190E1, 0x041192E1, 0x04119821, 
+  0x04119822, 0x04119841, 0x04119981, 0x04119B82, 0x04119C44, 0x04119C58, 
+  0x04119D84, 0x0411A821, 0x0411AB81, 0x0411AC38, 0x0411B021, 0x0411B1C1, 
+  0x0411B822, 0x0411B841, 0x0411B864, 0x0411B8A2, 0x0411B981, 0x0411D821, 
+  0x0411D826, 0x0411D862, 0x0411D8A1, 0x0411DC44, 0x0411E821, 0x0411E862, 
+  0x0411E8A1, 0x0411E8C1, 0x0411E981, 0x0411F824, 0x0411F842, 0x04121C21, 
+  0x04127421, 0x04127425, 0x04127443, 0x04128421, 0x04128461, 0x041285C1, 
+  0x041286C3, 0x041287C2, 0x041288E1, 0x04128AE1, 0x04128C21, 0x04129821, 
+  0x04129B81, 0x04129C41, 0x0412B821, 0x0412B862, 0x0412D861, 0x0412DC24, 
+  0x0412DC41, 0x0412E861, 0x0412F021, 0x0412F025, 0x0412F043, 0x04130C22, 
+  0x04130C41, 0x04131C24, 0x04131C34, 0x04131C38, 0x04131C42, 0x04131C4C, 
+  0x04131C81, 0x04131CC4, 0x04132C22, 0x04132C2C, 0x04132C41, 0x04132D41, 
+  0x04133422, 0x04133441, 0x04134C21, 0x04134CC1, 0x04135421, 0x04135425, 
+  0x04135443, 0x041354C1, 0x04135C42, 0x04135C81, 0x04136C24, 0x04136C42, 
+  0x04137424, 0x04137442, 0x04138424, 0x04138434, 0x04138442, 0x0413844C, 
+  0x04138481, 0x041384C4, 0x04138541, 0x04138542, 0x04138582, 0x04138681, 
+  0x04138686, 0x04138742, 0x04138784, 0x04138822, 0x0413882C, 0x04138841, 
+  0x041388C2, 0x04138962, 0x04138981, 0x04138A61, 0x04138B41, 0x04138C42, 
+  0x04138E41, 0x04139161, 0x04139824, 0x04139834, 0x04139838, 0x04139842, 
+  0x0413984C, 0x04139881, 0x041398C4, 0x04139982, 0x04139A81, 0x04139C44, 
+  0x0413A822, 0x0413A82C, 0x0413A841, 0x0413A981, 0x0413AC44, 0x0413B022, 
+  0x0413B041, 0x0413B844, 0x0413C821, 0x0413D021, 0x0413D824, 0x0413E822, 
+  0x0413F024, 0x0414F023, 0x04151C22, 0x04151C2C, 0x04151C41, 0x04151D41, 
+  0x04152C21, 0x04152C26, 0x04152CC1, 0x04153421, 0x04155423, 0x04156C22, 
+  0x04157422, 0x04158422, 0x0415842C, 0x04158441, 0x041584C2, 0x04158581, 
+  0x04158741, 0x04158961, 0x04159822, 0x0415982C, 0x04159841, 0x04159981, 
+  0x0415A821, 0x0415A826, 0x0415B021, 0x0415B824, 0x0415E841, 0x04160C21, 
+  0x04161C22, 0x04161C41, 0x04162C21, 0x04165C22, 0x04166C22, 0x04166C41, 
+  0x04167422, 0x04167441, 0x04168422, 0x04168441, 0x041684C1, 0x04168581, 
+  0x041685C2, 0x041686C1, 0x04168821, 0x041688C3, 0x041689C1, 0x04169822, 
+  0x04169841, 0x04169981, 0x04169C44, 0x0416A821, 0x0416B822, 0x0416B824, 
+  0x0416B841, 0x0416D821, 0x0416E822, 0x0416E841, 0x0416F022, 0x0416F041, 
+  0x04170C42, 0x04170C81, 0x04170F01, 0x04171C44, 0x04171C82, 0x04172C42, 
+  0x04172C81, 0x04173442, 0x04173481, 0x04175441, 0x04191CC1, 0x04199826, 
+  0x041998C1, 0x041A1C21, 0x041A5C21, 0x041A6C21, 0x041A8421, 0x041A8462, 
+  0x041A84A1, 0x041A8583, 0x041A85C1, 0x041A8861, 0x041A9821, 0x041A9862, 
+  0x041A98A1, 0x041AA861, 0x041AB821, 0x041AE821, 0x041B1C42, 0x041B1C81, 
+  0x041B3441, 0x041B8434, 0x041B844C, 0x041B84C4, 0x041B8542, 0x041B8C42, 
+  0x041B9842, 0x041BA841, 0x041BB022, 0x041BB041, 0x041BC821, 0x041BD021, 
+  0x041C7421, 0x041CB821, 0x041CF021, 0x041D3422, 0x041D3441, 0x041D5421, 
+  0x041D8424, 0x041D8434, 0x041D8442, 0x041D844C, 0x041D8481, 0x041D84C4, 
+  0x041D8541, 0x041D8542, 0x041D8582, 0x041D8681, 0x041D8822, 0x041D882C, 
+  0x041D8841, 0x041D88C2, 0x041D8941, 0x041D8981, 0x041D90C1, 0x041D9824, 
+  0x041D9842, 0x041D9881, 0x041DA822, 0x041DA841, 0x041DB022, 0x041DB041, 
+  0x041DD021, 0x041E1421, 0x041E1C42, 0x041E1C81, 0x041E2C41, 0x041E3422, 
+  0x041E3441, 0x041E5421, 0x041E6421, 0x041E8424, 0x041E8442, 0x041E844A, 
+  0x041E8481, 0x041E8486, 0x041E84A4, 0x041E84C2, 0x041E8541, 0x041E8582, 
+  0x041E8681, 0x041E8822, 0x041E8841, 0x041E8846, 0x041E8864, 0x041E88C1, 
+  0x041E8981, 0x041E9021, 0x041E9026, 0x041E9824, 0x041E9842, 0x041E9881, 
+  0x041EA822, 0x041EA841, 0x041EB022, 0x041EB041, 0x041ED021, 0x041EE021, 
+  0x041F0C82, 0x04208C21, 0x04209C22, 0x04209C41, 0x04209CC2, 0x04209D41, 
+  0x04209DC4, 0x04209F42, 0x0420AC21, 0x0420AC6C, 0x0420ACC1, 0x0420ADC2, 
+  0x0420B421, 0x0420D423, 0x0420D4C3, 0x0420EC22, 0x0420EC2C, 0x0420ECC2, 
+  0x0420F422, 0x0420F441, 0x0420F4C2, 0x0420F541, 0x04211C21, 0x04211CC1, 
+  0x04217421, 0x042174C1, 0x04218421, 0x04218461, 0x042185C1, 0x042185C5, 
+  0x042186C3, 0x042187C2, 0x04218863, 0x042188E1, 0x042188E5, 0x04218963, 
+  0x042189C3, 0x04218AE1, 0x04218C62, 0x04218CE4, 0x04218D62, 0x04218DC2, 
+  0x042190E3, 0x042194E2, 0x04219821, 0x04219B81, 0x0421B821, 0x0421B862, 
+  0x0421B8A1, 0x0421D861, 0x0421DC24, 0x0421E861, 0x0421F822, 0x04227423, 
+  0x042285C3, 0x042288E3, 0x04228CE2, 0x0422B861, 0x0422F023, 0x04230C21, 
+  0x04231C22, 0x04231C2C, 0x04231C41, 0x04232C21, 0x04233421, 0x042334C1, 
+  0x04235423, 0x04236C22, 0x04237422, 0x04237441, 0x04238422, 0x0423842C, 
+  0x04238441, 0x042384C2, 0x04238581, 0x04238741, 0x04238782, 0x04238821, 
+  0x04238961, 0x04238B81, 0x04238D41, 0x04239822, 0x0423982C, 0x04239841, 
+  0x04239981, 0x04239C42, 0x04239C44, 0x0423A821, 0x0423B021, 0x0423B824, 
+  0x0423B841, 0x0423D023, 0x0423E821, 0x0423E822, 0x0423E841, 0x0423F022, 
+  0x0423F041, 0x04251C21, 0x04257421, 0x04258421, 0x04258781, 0x04259821, 
+  0x0425E821, 0x0425F021, 0x04261C21, 0x04265C21, 0x04266C21, 0x04267421, 
+  0x04268421, 0x04268462, 0x042684A1, 0x042685C1, 0x04268781, 0x04268861, 
+  0x04268C21, 0x04268C62, 0x04269821, 0x04269862, 0x042698A1, 0x0426A861, 
+  0x0426B421, 0x0426B821, 0x0426B822, 0x0426E821, 0x0426F021, 0x04271C24, 
+  0x04271C42, 0x04271C81, 0x04272C22, 0x04273441, 0x042A8461, 0x042A8C62, 
+  0x042A9861, 0x042B1C22, 0x042B8422, 0x042B842A, 0x042B8446, 0x042B84C2, 
+  0x042B8826, 0x042B9822, 0x042D3421, 0x042D8422, 0x042D842C, 0x042D8441, 
+  0x042D84C2, 0x042D8581, 0x042D88C1, 0x042D9822, 0x042D9841, 0x042DB021, 
+  0x042E1C22, 0x042E1C41, 0x042E3421, 0x042E8422, 0x042E8441, 0x042E8446, 
+  0x042E8464, 0x042E84A2, 0x042E84C1, 0x042E8521, 0x042E8581, 0x042E8821, 
+  0x042E8862, 0x042E88A1, 0x042E9822, 0x042E9841, 0x042EA821, 0x042EB021, 
+  0x0430B424, 0x0430B438, 0x0430B442, 0x0430D422, 0x0430F444, 0x0430F482, 
+  0x04317424, 0x04317442, 0x043186C2, 0x04318862, 0x0431B444, 0x0431B842, 
+  0x0431B881, 0x0431D442, 0x0431D841, 0x0432AC41, 0x0432B841, 0x0432E821, 
+  0x04333424, 0x04333442, 0x04335422, 0x04338542, 0x04338C82, 0x04368681, 
+  0x04409C21, 0x04409CC1, 0x0440F421, 0x0440F4C1, 0x044185C3, 0x044188E3, 
+  0x04418CE2, 0x0441B861, 0x04431C21, 0x04431CC1, 0x04437421, 0x04438421, 
+  0x04438781, 0x04439821, 0x0443B841, 0x0443E821, 0x0443F021, 0x04468461, 
+  0x04469861, 0x04470C21, 0x04471C22, 0x044B8421, 0x044B8426, 0x044E8462, 
+  0x044E84A1, 0x044E8861, 0x044E9821, 0x044F1421, 0x0450F424, 0x0450F442, 
+  0x0451B841, 0x04609C24, 0x04609C34, 0x04609C38, 0x04609C42, 0x04609C4C, 
+  0x04609CC4, 0x04609D42, 0x04609E41, 0x0460AC22, 0x0460AC2C, 0x0460AC41, 
+  0x0460ACC2, 0x0460AD41, 0x0460AD81, 0x0460CC21, 0x0460CCC1, 0x0460D425, 
+  0x0460D443, 0x0460DC81, 0x0460EC24, 0x0460EC42, 0x0460F424, 0x0460F442, 
+  0x0460F481, 0x04611C22, 0x04611C2C, 0x04612C21, 0x04615423, 0x04616C22, 
+  0x04617422, 0x04618421, 0x04618462, 0x046184A1, 0x046184E4, 0x04618562, 
+  0x046185A2, 0x046186A1, 0x04618861, 0x046188E2, 0x046189A1, 0x04618C22, 
+  0x04618C64, 0x04618CA2, 0x04619462, 0x0461B422, 0x04628461, 0x046284E2, 
+  0x046285A1, 0x04628C62, 0x04638434, 0x04638442, 0x0463844C, 0x04638481, 
+  0x04638582, 0x04638681, 0x0463882C, 0x04638841, 0x04638981, 0x04638C24, 
+  0x04638C42, 0x04658422, 0x0465842C, 0x04658441, 0x046584C2, 0x04658541, 
+  0x04658581, 0x04658821, 0x04668421, 0x04668441, 0x04668462, 0x046684A1, 
+  0x04668861, 0x04668C22, 0x04668C41, 0x04698421, 0x046984C1, 0x046A8461, 
+  0x046A8C21, 0x046A9821, 0x046B8442, 0x046D8424, 0x046D8442, 0x046D8481, 
+  0x046D8822, 0x046D8841, 0x046E8442, 0x046E8481, 0x046E8841, 0x04718864, 
+  0x047188A2, 0x04719062, 0x04728862, 0x04A09C22, 0x04A09C2C, 0x04A09CC2, 
+  0x04A09D41, 0x04A0AC21, 0x04A0AC62, 0x04A0ACA1, 0x04A0ACC1, 0x04A0CC61, 
+  0x04A0D423, 0x04A0EC22, 0x04A0F422, 0x04A12C61, 0x04A18461, 0x04A184E2, 
+  0x04A185A1, 0x04A18863, 0x04A18C62, 0x04A19C22, 0x04A3842C, 0x04A38441, 
+  0x04A38581, 0x04A58421, 0x04A584C1, 0x04A68461, 0x04AB8441, 0x04AD8422, 
+  0x04AD8441, 0x04AD8821, 0x04AE8441, 0x04B18862, 0x04C08C21, 0x04C09C22, 
+  0x04C09C2A, 0x04C09C2C, 0x04C09C41, 0x04C09C46, 0x04C09CC2, 0x04C09D41, 
+  0x04C09D81, 0x04C0AC21, 0x04C0AC26, 0x04C0ACC1, 0x04C0B421, 0x04C0EC22, 
+  0x04C0EC41, 0x04C0F422, 0x04C0F441, 0x04C11C21, 0x04C11C26, 0x04C11CC1, 
+  0x04C16C21, 0x04C17421, 0x04C185C1, 0x04C31C22, 0x04C31C41, 0x04C32C21, 
+  0x04C38441, 0x04C384C2, 0x04C38541, 0x04C38581, 0x04C388C1, 0x04C38C42, 
+  0x04C39822, 0x04C39841, 0x04C3A821, 0x04C51C21, 0x04C584C1, 0x04C59821, 
+  0x04C70C22, 0x04C70C41, 0x04C71421, 0x04CB0C21, 0x04CB8422, 0x04CB8441, 
+  0x04CB8821, 0x04CD8441, 0x04E0CC22, 0x04E0CC41, 0x04E14C21, 0x04E18422, 
+  0x04E18441, 0x04E184C2, 0x04E18581, 0x04E18821, 0x04E18862, 0x04E188A1, 
+  0x04E18C42, 0x04E18C81, 0x04E19061, 0x04E19441, 0x04E1B021, 0x04E28861, 
+  0x04E28C41, 0x04E38424, 0x04E38442, 0x04E38822, 0x04E58422, 0x04E68422, 
+  0x04E68441, 0x04E68821, 0x04E98422, 0x04E98441, 0x04E98821, 0x04EA8421, 
+  0x0520AC61, 0x052D8421, 0x05409C21, 0x05409C26, 0x05409CC1, 0x0540B461, 
+  0x0540EC21, 0x0540F421, 0x05419C22, 0x05419C41, 0x0541AC21, 0x05429C21, 
+  0x05431C21, 0x054384C1, 0x05438C41, 0x05439821, 0x05470C21, 0x054B8421, 
+  0x0560CC21, 0x05618861, 0x05618C41, 0x05638422, 0x05668421, 0x05698421, 
+  0x0580F421, 0x05839821, 0x05870C21, 0x05A18421, 0x05A18462, 0x05A184A1, 
+  0x05A18861, 0x05A19821, 0x05A28461, 0x05A28C21, 0x05A38422, 0x05A38441, 
+  0x05A58441, 0x05A68441, 0x05C0B441, 0x05E18424, 0x05E18822, 0x05E18841, 
+  0x05E19021, 0x05E28821, 0x06168444, 0x06168482, 0x06168842, 0x06169844, 
+  0x06169882, 0x0616A842, 0x061A1C42, 0x061A1C81, 0x061A2C41, 0x061A8442, 
+  0x061A8481, 0x061A8485, 0x061A84C4, 0x061A8542, 0x061A8841, 0x061A8883, 
+  0x061A88C2, 0x061A9824, 0x061A9842, 0x061A9881, 0x061AA822, 0x061AA841, 
+  0x061E1424, 0x061E1442, 0x061E1481, 0x061E2422, 0x061E2441, 0x061E8484, 
+  0x061E8844, 0x061E8882, 0x06258C42, 0x06268442, 0x06269842, 0x062A1C41, 
+  0x062A8441, 0x062A8483, 0x062A84C2, 0x062A9822, 0x062A9841, 0x062E1422, 
+  0x062E1441, 0x062E8444, 0x062E8482, 0x0640D425, 0x0640D443, 0x06415423, 
+  0x06668444, 0x06668482, 0x06668822, 0x06668841, 0x06668842, 0x06668881, 
+  0x06669021, 0x06669041, 0x066A8442, 0x066A8481, 0x066A8821, 0x066A8841, 
+  0x06A68442, 0x06A68481, 0x06A68821, 0x06A68841, 0x06AA8441, 0x06C0D422, 
+  0x06C0D441, 0x06C15421, 0x06E18824, 0x06E18842, 0x06E18881, 0x06E19022, 
+  0x06E19041, 0x06E28822, 0x06E28841, 0x0740D421, 0x07618424, 0x07618442, 
+  0x07618481, 0x07618822, 0x07618841, 0x07628422, 0x07628441, 0x08109C22, 
+  0x08109CC2, 0x08109DC4, 0x08109EC2, 0x08109F42, 0x0810AC6C, 0x0810ADC2, 
+  0x0810EC22, 0x0810EC2C, 0x0810ECC2, 0x0810F422, 0x08111C21, 0x08111DC2, 
+  0x08118421, 0x08118461, 0x081185C1, 0x081186C3, 0x081187C2, 0x081188E1, 
+  0x08118BC1, 0x08119821, 0x081198E2, 0x08119961, 0x08119B81, 0x0811A8E1, 
+  0x0811B821, 0x0811B862, 0x0811D861, 0x0811DC24, 0x0811E861, 0x0811F822, 
+  0x0811F841, 0x08127423, 0x081287C1, 0x081298E1, 0x0812F023, 0x0812F821, 
+  0x08131C22, 0x08131C2C, 0x08131C41, 0x08131D41, 0x08132C21, 0x08132CC1, 
+  0x08133421, 0x08135423, 0x08136C22, 0x08137422, 0x08138422, 0x0813842C, 
+  0x08138441, 0x081384C2, 0x08138541, 0x08138581, 0x08138741, 0x08138821, 
+  0x081388C1, 0x08138961, 0x08138C24, 0x08138C42, 0x08139422, 0x08139822, 
+  0x0813982C, 0x08139841, 0x08139941, 0x08139981, 0x08139C44, 0x08139C82, 
+  0x0813A821, 0x0813A8C1, 0x0813AC42, 0x0813B021, 0x0813B824, 0x08151C21, 
+  0x08151CC1, 0x08155C21, 0x08158421, 0x081584C1, 0x08158C22, 0x08159821, 
+  0x081598C1, 0x08159C24, 0x08159C42, 0x0815AC22, 0x0815B822, 0x0815B841, 
+  0x0815D821, 0x08161C21, 0x08166C21, 0x08168421, 0x08168462, 0x081684A1, 
+  0x081685C1, 0x08168861, 0x08169821, 0x08169862, 0x081698A1, 0x0816A861, 
+  0x0816B821, 0x0816E821, 0x08171C24, 0x08171C42, 0x08171C81, 0x08172C22, 
+  0x08172C41, 0x08173422, 0x08173441, 0x08174C21, 0x08175421, 0x08199C22, 
+  0x0819B821, 0x081A8461, 0x081A9861, 0x081B1C22, 0x081B2C21, 0x081B3421, 
+  0x081B84C2, 0x081B8541, 0x081B8C24, 0x081B9422, 0x081BA821, 0x081BB021, 
+  0x081D3421, 0x081D8422, 0x081D842C, 0x081D8441, 0x081D84C2, 0x081D8541, 
+  0x081D8581, 0x081D88C1, 0x081D9822, 0x081D9841, 0x081DB021, 0x081E1C22, 
+  0x081E1C41, 0x081E2C21, 0x081E3421, 0x081E8422, 0x081E8441, 0x081E8446, 
+  0x081E8464, 0x081E84A2, 0x081E84C1, 0x081E84C2, 0x081E8541, 0x081E8581, 
+  0x081E8862, 0x081E88C1, 0x081E9822, 0x081E9841, 0x081EB021, 0x08209C21, 
+  0x08209CC1, 0x08209DC2, 0x0820F421, 0x0820F425, 0x0820F443, 0x0820F4C1, 
+  0x08217423, 0x082185C3, 0x082187C1, 0x082188E3, 0x08218CE2, 0x082198E1, 
+  0x0821B861, 0x0821F821, 0x08231C21, 0x08237421, 0x08238421, 0x082384C1, 
+  0x08238781, 0x08238C22, 0x08239821, 0x08239C24, 0x08239C42, 0x0823AC22, 
+  0x0823B822, 0x0823B841, 0x0823D821, 0x0823E821, 0x0823F021, 0x08259C22, 
+  0x0825B821, 0x08268461, 0x08269861, 0x08271C22, 0x08271C41, 0x08272C21, 
+  0x08273421, 0x082B1C21, 0x082B8421, 0x082B8426, 0x082D84C1, 0x082E1C21, 
+  0x082E8462, 0x082E84A1, 0x082E84C1, 0x082E8861, 0x082E9821, 0x0830F424, 
+  0x0830F442, 0x08317422, 0x0831B841, 0x0840F423, 0x08439C22, 0x0843B821, 
+  0x08471C21, 0x084E8461, 0x0850F422, 0x08609C22, 0x08609C2C, 0x08609C41, 
+  0x08609CC2, 0x08609D41, 0x0860AC21, 0x0860ACC1, 0x0860D423, 0x0860EC22, 
+  0x0860F422, 0x08611C21, 0x08618461, 0x086184E2, 0x08618561, 0x086185A1, 
+  0x086188E1, 0x08618C62, 0x086284E1, 0x08631C22, 0x08632C21, 0x0863842C, 
+  0x08638441, 0x086384C2, 0x08638541, 0x08638581, 0x08651C21, 0x08658421, 
+  0x086584C1, 0x08659821, 0x08668461, 0x086B8422, 0x086B8441, 0x086B8821, 
+  0x086D8422, 0x086D8441, 0x086E8441, 0x08718862, 0x08A09C21, 0x08A09CC1, 
+  0x08A0AC61, 0x08A0DC21, 0x08A184E1, 0x08A31C21, 0x08A384C1, 0x08AB8421, 
+  0x08AD8421, 0x08C09C21, 0x08C09C26, 0x08C09CC1, 0x08C0EC21, 0x08C0F421, 
+  0x08C31C21, 0x08C384C1, 0x08C39821, 0x08C70C21, 0x08CB8421, 0x08E09C24, 
+  0x08E09C42, 0x08E0AC22, 0x08E0AC41, 0x08E0CC21, 0x08E11C22, 0x08E12C21, 
+  0x08E18861, 0x08E18C41, 0x08E38422, 0x08E58422, 0x08E58441, 0x08E58821, 
+  0x08E68421, 0x08E98421, 0x09419C21, 0x09609C22, 0x0960AC21, 0x09658421, 
+  0x09A18461, 0x09C09C22, 0x09C09C41, 0x09C0AC21, 0x09C11C21, 0x09E18821, 
+  0x0A168442, 0x0A169842, 0x0A1A1C41, 0x0A1A8441, 0x0A1A8483, 0x0A1A84C2, 
+  0x0A1A8541, 0x0A1A88C1, 0x0A1A9822, 0x0A1A9841, 0x0A1E1422, 0x0A1E1441, 
+  0x0A1E8444, 0x0A1E8482, 0x0A1E8842, 0x0A2A84C1, 0x0A2E8442, 0x0A40D423, 
+  0x0A668442, 0x0A668481, 0x0A668821, 0x0A668841, 0x0A6A8441, 0x0AC0D421, 
+  0x0AE18822, 0x0AE18841, 0x0B618422, 0x0B618441, 0x0C1189C2, 0x0C118AC1, 
+  0x0C1191C1, 0x0C1289C1, 0x0C132C24, 0x0C132C42, 0x0C134C22, 0x0C134C41, 
+  0x0C138584, 0x0C138682, 0x0C138982, 0x0C138A81, 0x0C13A824, 0x0C13A842, 
+  0x0C13C822, 0x0C151C24, 0x0C151C42, 0x0C152C22, 0x0C152C41, 0x0C154C21, 
+  0x0C158582, 0x0C158681, 0x0C159824, 0x0C159842, 0x0C15A822, 0x0C15A841, 
+  0x0C15C821, 0x0C191C22, 0x0C192C21, 0x0C199822, 0x0C19A821, 0x0C2189C1, 
+  0x0C238582, 0x0C238681, 0x0C451C21, 0x0CA09C24, 0x0CA09C42, 0x0CA0AC22, 
+  0x0D209C22, 0x10138421, 0x121A84C1, 0x121E8442, 0x141189C1, 0x14132C22, 
+  0x14134C21, 0x14138582, 0x14138681, 0x1413A822, 0x14151C22, 0x14152C21, 
+  0x14159822, 0x1415A821, 0x14A09C22, 0x18109C24, 0x18109C34, 0x18109C42, 
+  0x18109C4C, 0x18109CC4, 0x18109D42, 0x1810AC22, 0x1810AC2C, 0x1810ACC2, 
+  0x1810EC24, 0x1810EC42, 0x18111C22, 0x18111C2C, 0x18111CC2, 0x18116C22, 
+  0x18131C24, 0x18131C42, 0x18132C22, 0x18138434, 0x1813844C, 0x18138582, 
+  0x18138681, 0x1813882C, 0x18138981, 0x18139824, 0x18139842, 0x1813A822, 
+  0x18151C22, 0x18158422, 0x1815842C, 0x18158441, 0x181584C2, 0x18158541, 
+  0x18158581, 0x18158821, 0x181588C1, 0x18159822, 0x18159841, 0x1815A821, 
+  0x18198421, 0x181984C1, 0x18199821, 0x181D8424, 0x181D8442, 0x181D8822, 
+  0x18209C22, 0x18209C2C, 0x18209CC2, 0x1820EC22, 0x18231C22, 0x1823842C, 
+  0x18238581, 0x18239822, 0x18258421, 0x182584C1, 0x18259821, 0x182D8422, 
+  0x182D8441, 0x182D8821, 0x18398422, 0x18398441, 0x18398821, 0x184D8421, 
+  0x18598421, 0x18609C24, 0x18609C42, 0x1860AC22, 0x18611C22, 0x18A09C22, 
+  0x28109C22, 0x28109C2C, 0x28109CC2, 0x2810DC22, 0x2810EC22, 0x28131C22, 
+  0x2813842C, 0x28138581, 0x28139822, 0x28158421, 0x281584C1, 0x28159821, 
+  0x281D8422, 0x281D8441, 0x281D8821, 0x282D8421, 0x28398421, 0x28609C22, 
+  0x30131C22, 0x30131C41, 0x30132C21, 0x30138422, 0x30138441, 0x301384C2, 
+  0x30138541, 0x30138821, 0x301388C1, 0x30138C24, 0x30138C42, 0x30139422, 
+  0x30139822, 0x30139841, 0x3013A821, 0x30151C21, 0x30158421, 0x301584C1, 
+  0x30158C22, 0x30158C41, 0x30159421, 0x30159821, 0x30168462, 0x301684A1, 
+  0x30168861, 0x30198C21, 0x301A8461, 0x301B8422, 0x301B8441, 0x301B8821, 
+  0x30231C21, 0x30238421, 0x302384C1, 0x30238C22, 0x30239821, 0x30258C21, 
+  0x30268461, 0x302B8421, 0x30609C22, 0x30609C41, 0x3060AC21, 0x30611C21, 
+  0x30A09C21
+};
+
+const uint8_t SolvedMoves[1366] PROGMEM = {
+  0x23, 0x33, 0x22, 0x02, 0x33, 0x02, 0x32, 0x01, 0x11, 0x02, 0x44, 0x10, 
+  0x01, 0x40, 0x31, 0x13, 0x40, 0x32, 0x23, 0x33, 0x32, 0x33, 0x33, 0x33, 
+  0x33, 0x33, 0x33, 0x12, 0x13, 0x31, 0x03, 0x31, 0x24, 0x32, 0x13, 0x12, 
+  0x02, 0x30, 0x34, 0x22, 0x22, 0x24, 0x32, 0x13, 0x23, 0x32, 0x33, 0x33, 
+  0x01, 0x22, 0x21, 0x44, 0x03, 0x30, 0x34, 0x30, 0x11, 0x33, 0x03, 0x31, 
+  0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 0x43, 0x42, 0x32, 0x32, 0x23, 0x42, 
+  0x24, 0x30, 0x33, 0x33, 0x14, 0x14, 0x33, 0x33, 0x23, 0x33, 0x22, 0x20, 
+  0x22, 0x20, 0x03, 0x41, 0x34, 0x40, 0x41, 0x31, 0x31, 0x41, 0x21, 0x00, 
+  0x22, 0x11, 0x22, 0x22, 0x22, 0x44, 0x22, 0x23, 0x33, 0x23, 0x11, 0x20, 
+  0x33, 0x10, 0x02, 0x15, 0x32, 0x43, 0x33, 0x14, 0x43, 0x32, 0x35, 0x22, 
+  0x22, 0x21, 0x22, 0x30, 0x15, 0x32, 0x33, 0x31, 0x33, 0x11, 0x33, 0x33, 
+  0x33, 0x22, 0x32, 0x25, 0x22, 0x13, 0x33, 0x05, 0x23, 0x52, 0x33, 0x05, 
+  0x13, 0x13, 0x31, 0x22, 0x23, 0x23, 0x22, 0x11, 0x33, 0x33, 0x31, 0x15, 
+  0x31, 0x03, 0x44, 0x32, 0x30, 0x23, 0x01, 0x23, 0x22, 0x25, 0x22, 0x22, 
+  0x25, 0x22, 0x01, 0x41, 0x53, 0x53, 0x23, 0x33, 0x22, 0x32, 0x00, 0x43, 
+  0x24, 0x21, 0x12, 0x00, 0x12, 0x22, 0x20, 0x11, 0x22, 0x25, 0x51, 0x55, 
+  0x55, 0x01, 0x41, 0x24, 0x12, 0x02, 0x55, 0x50, 0x52, 0x41, 0x51, 0x55, 
+  0x25, 0x22, 0x40, 0x11, 0x20, 0x42, 0x21, 0x14, 0x44, 0x11, 0x12, 0x15, 
+  0x24, 0x22, 0x14, 0x10, 0x11, 0x14, 0x00, 0x22, 0x21, 0x22, 0x01, 0x12, 
+  0x42, 0x51, 0x55, 0x22, 0x52, 0x15, 0x01, 0x24, 0x02, 0x02, 0x21, 0x51, 
+  0x21, 0x22, 0x12, 0x50, 0x22, 0x22, 0x22, 0x44, 0x24, 0x22, 0x44, 0x44, 
+  0x22, 0x44, 0x40, 0x41, 0x44, 0x04, 0x14, 0x01, 0x44, 0x44, 0x33, 0x23, 
+  0x33, 0x33, 0x33, 0x31, 0x43, 0x13, 0x23, 0x04, 0x33, 0x00, 0x32, 0x04, 
+  0x22, 0x22, 0x33, 0x23, 0x33, 0x20, 0x03, 0x41, 0x11, 0x33, 0x44, 0x33, 
+  0x33, 0x33, 0x33, 0x32, 0x33, 0x33, 0x22, 0x02, 0x42, 0x41, 0x22, 0x14, 
+  0x12, 0x22, 0x30, 0x01, 0x31, 0x44, 0x33, 0x14, 0x42, 0x44, 0x24, 0x22, 
+  0x22, 0x22, 0x32, 0x44, 0x11, 0x33, 0x22, 0x41, 0x42, 0x41, 0x22, 0x31, 
+  0x40, 0x11, 0x33, 0x11, 0x33, 0x23, 0x34, 0x41, 0x34, 0x33, 0x34, 0x34, 
+  0x22, 0x44, 0x14, 0x44, 0x34, 0x14, 0x33, 0x34, 0x23, 0x33, 0x42, 0x44, 
+  0x44, 0x11, 0x21, 0x33, 0x01, 0x42, 0x24, 0x22, 0x43, 0x21, 0x31, 0x02, 
+  0x11, 0x33, 0x23, 0x22, 0x24, 0x41, 0x12, 0x44, 0x24, 0x41, 0x14, 0x02, 
+  0x44, 0x14, 0x45, 0x14, 0x44, 0x01, 0x24, 0x00, 0x44, 0x40, 0x24, 0x21, 
+  0x02, 0x22, 0x24, 0x22, 0x12, 0x40, 0x10, 0x22, 0x42, 0x42, 0x25, 0x22, 
+  0x01, 0x44, 0x23, 0x32, 0x33, 0x34, 0x33, 0x33, 0x32, 0x13, 0x33, 0x34, 
+  0x23, 0x33, 0x22, 0x32, 0x32, 0x23, 0x43, 0x40, 0x44, 0x52, 0x45, 0x44, 
+  0x14, 0x03, 0x33, 0x34, 0x23, 0x01, 0x01, 0x30, 0x43, 0x44, 0x24, 0x52, 
+  0x44, 0x41, 0x24, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 
+  0x30, 0x02, 0x21, 0x31, 0x43, 0x13, 0x01, 0x13, 0x43, 0x34, 0x22, 0x42, 
+  0x42, 0x24, 0x24, 0x22, 0x22, 0x22, 0x22, 0x44, 0x32, 0x23, 0x53, 0x30, 
+  0x40, 0x24, 0x42, 0x32, 0x10, 0x24, 0x21, 0x14, 0x10, 0x21, 0x22, 0x11, 
+  0x14, 0x10, 0x11, 0x53, 0x23, 0x32, 0x33, 0x33, 0x33, 0x55, 0x45, 0x44, 
+  0x33, 0x22, 0x10, 0x33, 0x23, 0x31, 0x11, 0x30, 0x22, 0x33, 0x33, 0x03, 
+  0x00, 0x34, 0x31, 0x23, 0x32, 0x22, 0x01, 0x44, 0x54, 0x55, 0x55, 0x55, 
+  0x25, 0x00, 0x41, 0x04, 0x40, 0x54, 0x45, 0x55, 0x25, 0x51, 0x10, 0x42, 
+  0x12, 0x12, 0x21, 0x12, 0x41, 0x04, 0x34, 0x44, 0x44, 0x22, 0x33, 0x22, 
+  0x33, 0x44, 0x23, 0x31, 0x12, 0x14, 0x30, 0x41, 0x24, 0x02, 0x15, 0x21, 
+  0x20, 0x14, 0x24, 0x22, 0x40, 0x11, 0x01, 0x30, 0x23, 0x22, 0x22, 0x42, 
+  0x05, 0x11, 0x44, 0x32, 0x33, 0x33, 0x23, 0x33, 0x43, 0x40, 0x20, 0x43, 
+  0x03, 0x22, 0x10, 0x24, 0x21, 0x22, 0x32, 0x31, 0x13, 0x02, 0x31, 0x33, 
+  0x33, 0x14, 0x23, 0x22, 0x22, 0x22, 0x21, 0x14, 0x11, 0x03, 0x54, 0x35, 
+  0x25, 0x25, 0x34, 0x33, 0x33, 0x43, 0x10, 0x55, 0x52, 0x52, 0x22, 0x22, 
+  0x20, 0x10, 0x01, 0x32, 0x22, 0x12, 0x22, 0x05, 0x11, 0x33, 0x33, 0x33, 
+  0x21, 0x22, 0x12, 0x12, 0x33, 0x30, 0x12, 0x55, 0x51, 0x51, 0x25, 0x32, 
+  0x52, 0x55, 0x15, 0x30, 0x32, 0x12, 0x32, 0x32, 0x23, 0x31, 0x22, 0x10, 
+  0x32, 0x33, 0x33, 0x32, 0x33, 0x13, 0x52, 0x55, 0x51, 0x22, 0x35, 0x21, 
+  0x33, 0x22, 0x12, 0x11, 0x23, 0x12, 0x12, 0x15, 0x00, 0x22, 0x01, 0x30, 
+  0x53, 0x50, 0x01, 0x10, 0x44, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 
+  0x31, 0x43, 0x12, 0x13, 0x01, 0x30, 0x12, 0x31, 0x05, 0x35, 0x11, 0x22, 
+  0x33, 0x31, 0x32, 0x33, 0x32, 0x43, 0x41, 0x14, 0x15, 0x01, 0x31, 0x11, 
+  0x30, 0x03, 0x34, 0x50, 0x31, 0x32, 0x33, 0x31, 0x31, 0x22, 0x33, 0x13, 
+  0x43, 0x40, 0x21, 0x02, 0x35, 0x41, 0x22, 0x55, 0x21, 0x32, 0x35, 0x30, 
+  0x03, 0x35, 0x10, 0x44, 0x30, 0x31, 0x31, 0x31, 0x55, 0x45, 0x25, 0x22, 
+  0x22, 0x32, 0x34, 0x23, 0x32, 0x34, 0x12, 0x31, 0x22, 0x25, 0x23, 0x31, 
+  0x13, 0x33, 0x05, 0x34, 0x55, 0x21, 0x55, 0x32, 0x03, 0x33, 0x33, 0x33, 
+  0x34, 0x35, 0x33, 0x55, 0x13, 0x21, 0x32, 0x12, 0x33, 0x33, 0x33, 0x33, 
+  0x35, 0x32, 0x35, 0x23, 0x23, 0x21, 0x33, 0x33, 0x33, 0x22, 0x12, 0x33, 
+  0x43, 0x44, 0x55, 0x21, 0x11, 0x21, 0x42, 0x25, 0x21, 0x21, 0x11, 0x21, 
+  0x24, 0x01, 0x44, 0x12, 0x44, 0x45, 0x21, 0x20, 0x02, 0x50, 0x11, 0x01, 
+  0x11, 0x55, 0x22, 0x21, 0x22, 0x02, 0x11, 0x22, 0x12, 0x20, 0x21, 0x22, 
+  0x02, 0x11, 0x00, 0x11, 0x11, 0x50, 0x24, 0x22, 0x02, 0x22, 0x24, 0x11, 
+  0x22, 0x22, 0x10, 0x22, 0x14, 0x44, 0x22, 0x44, 0x44, 0x42, 0x44, 0x44, 
+  0x14, 0x14, 0x33, 0x33, 0x03, 0x30, 0x43, 0x11, 0x23, 0x42, 0x11, 0x23, 
+  0x21, 0x33, 0x31, 0x31, 0x33, 0x40, 0x14, 0x31, 0x24, 0x23, 0x44, 0x22, 
+  0x34, 0x11, 0x43, 0x34, 0x01, 0x24, 0x22, 0x32, 0x44, 0x13, 0x24, 0x32, 
+  0x44, 0x44, 0x14, 0x50, 0x43, 0x43, 0x33, 0x12, 0x34, 0x31, 0x53, 0x23, 
+  0x11, 0x23, 0x23, 0x10, 0x31, 0x44, 0x41, 0x32, 0x22, 0x44, 0x40, 0x41, 
+  0x22, 0x42, 0x44, 0x14, 0x42, 0x04, 0x21, 0x12, 0x44, 0x44, 0x10, 0x21, 
+  0x22, 0x22, 0x22, 0x23, 0x32, 0x55, 0x33, 0x45, 0x23, 0x31, 0x33, 0x33, 
+  0x34, 0x13, 0x33, 0x44, 0x04, 0x33, 0x41, 0x42, 0x34, 0x44, 0x43, 0x33, 
+  0x43, 0x42, 0x14, 0x20, 0x22, 0x55, 0x04, 0x25, 0x01, 0x22, 0x22, 0x12, 
+  0x22, 0x45, 0x31, 0x51, 0x10, 0x14, 0x33, 0x33, 0x33, 0x13, 0x11, 0x41, 
+  0x30, 0x14, 0x13, 0x32, 0x42, 0x13, 0x43, 0x33, 0x13, 0x55, 0x22, 0x32, 
+  0x32, 0x13, 0x43, 0x25, 0x34, 0x44, 0x44, 0x44, 0x04, 0x14, 0x04, 0x11, 
+  0x22, 0x51, 0x31, 0x43, 0x53, 0x24, 0x12, 0x54, 0x32, 0x54, 0x34, 0x10, 
+  0x22, 0x32, 0x34, 0x34, 0x14, 0x41, 0x24, 0x24, 0x02, 0x43, 0x21, 0x12, 
+  0x21, 0x22, 0x02, 0x51, 0x34, 0x33, 0x33, 0x05, 0x21, 0x31, 0x42, 0x32, 
+  0x33, 0x52, 0x31, 0x32, 0x12, 0x10, 0x42, 0x15, 0x33, 0x12, 0x45, 0x22, 
+  0x33, 0x22, 0x32, 0x33, 0x33, 0x43, 0x44, 0x10, 0x42, 0x13, 0x03, 0x21, 
+  0x15, 0x30, 0x03, 0x32, 0x33, 0x23, 0x35, 0x33, 0x52, 0x30, 0x12, 0x21, 
+  0x32, 0x21, 0x13, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x23, 0x21, 0x12, 
+  0x10, 0x12, 0x22, 0x22, 0x01, 0x22, 0x15, 0x25, 0x12, 0x22, 0x42, 0x44, 
+  0x44, 0x24, 0x44, 0x44, 0x34, 0x31, 0x33, 0x24, 0x22, 0x44, 0x01, 0x22, 
+  0x43, 0x32, 0x14, 0x34, 0x22, 0x21, 0x32, 0x13, 0x05, 0x21, 0x32, 0x53, 
+  0x31, 0x23, 0x11, 0x55, 0x40, 0x33, 0x23, 0x31, 0x23, 0x33, 0x23, 0x12, 
+  0x42, 0x55, 0x04, 0x05, 0x20, 0x30, 0x23, 0x21, 0x23, 0x33, 0x35, 0x52, 
+  0x31, 0x53, 0x24, 0x32, 0x23, 0x53, 0x15, 0x31, 0x22, 0x23, 0x31, 0x22, 
+  0x32, 0x35, 0x22, 0x43, 0x12, 0x13, 0x33, 0x13, 0x23, 0x25, 0x31, 0x31, 
+  0x33, 0x13, 0x42, 0x21, 0x43, 0x40, 0x24, 0x21, 0x44, 0x14, 0x41, 0x42, 
+  0x52, 0x15, 0x21, 0x25, 0x15, 0x10, 0x22, 0x12, 0x11, 0x22, 0x00, 0x11, 
+  0x22, 0x11, 0x42, 0x34, 0x40, 0x01, 0x33, 0x24, 0x13, 0x04, 0x03, 0x43, 
+  0x25, 0x32, 0x31, 0x13, 0x33, 0x40, 0x33, 0x23, 0x41, 0x43, 0x44, 0x24, 
+  0x24, 0x24, 0x12, 0x31, 0x04, 0x23, 0x02, 0x44, 0x14, 0x24, 0x24, 0x43, 
+  0x34, 0x11, 0x23, 0x11, 0x21, 0x53, 0x31, 0x53, 0x42, 0x43, 0x05, 0x21, 
+  0x15, 0x21, 0x22, 0x01, 0x32, 0x41, 0x45, 0x44, 0x44, 0x32, 0x14, 0x02, 
+  0x21, 0x41, 0x33, 0x52, 0x33, 0x21, 0x45, 0x23, 0x32, 0x02, 0x21, 0x23, 
+  0x33, 0x11, 0x41, 0x21, 0x22, 0x10, 0x11, 0x42, 0x44, 0x33, 0x24, 0x01, 
+  0x22, 0x15, 0x01, 0x32, 0x10, 0x13, 0x01, 0x22, 0x13, 0x00, 0x01, 0x51, 
+  0x33, 0x12, 0x10, 0x05, 0x02, 0x05, 0x44, 0x04, 0x22, 0x52, 0x52, 0x50, 
+  0x53, 0x32, 0x25, 0x30, 0x00, 0x15, 0x11, 0x21, 0x22, 0x10, 0x33, 0x33, 
+  0x10, 0x52, 0x13, 0x25, 0x31, 0x21, 0x33, 0x13, 0x41, 0x21, 0x42, 0x21, 
+  0x14, 0x02, 0x21, 0x44, 0x40, 0x42, 0x11, 0x43, 0x43, 0x21, 0x14, 0x42, 
+  0x04, 0x22, 0x43, 0x32, 0x00, 0x20, 0x10, 0x33, 0x03, 0x10, 0x42, 0x24, 
+  0x12, 0x33, 0x33, 0x33, 0x32, 0x42, 0x13, 0x23, 0x32, 0x22, 0x21, 0x23, 
+  0x12, 0x22, 0x41, 0x33, 0x24, 0x23, 0x03, 0x44, 0x34, 0x02
+};